@@ -0,0 +1,58 @@
+/*! \file analyzer.cc
+ *
+ * \brief Includes definitions of the Analyzer class members defined in the
+ * analyzer.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * Analyzer. It also instantiates the class template BasicAnalyzer for all the
+ * supported types of the attribute set.
+ *
+ */
+#include "analyzer.h"
+#include "basic_analyzer.h"
+#include "relation.h"
+
+const unsigned int Analyzer::CACHE_SIZE;
+
+/**
+ *
+ * @param rel the relation object for which the Analyzer is created.
+ * @param table the FDTable of the current state of the relation.
+ * @return The shared pointer to the newly created Analyzer object.
+ * @details Same as the Analyzer of the projection on the attribute set of the
+ * relation.
+ */
+std::shared_ptr<const Analyzer> Analyzer::create(const Relation &rel,
+        const std::shared_ptr<const FDTable> &table) {
+    return create(rel, table, rel.getAttributes());
+}
+
+/**
+ *
+ * @param rel the relation object whose key engine is used.
+ * @param table the FDTable of the current state of the relation.
+ * @param attribs the attribute set of the relation or of its projection, a
+ * subset of the attribute set of the relation.
+ * @return The shared pointer to the newly created Analyzer object.
+ * @details The Analyzer is same as the Analyzer of the relation with the
+ * attribute set attribs and the dependencies of Relation::project, but no
+ * dependency is copied, the rows of the table which are not part of the
+ * projection are skipped by the Analyzer. The identifiers are the ones of the
+ * table, so the BasicAnalyzer is instantiated with the smallest FixedAttrSet of
+ * 64, 128, 256 or 512 identifiers which can hold all the attributes of the
+ * table, and with the AttrSet if the relation have more attributes than that.
+ */
+std::shared_ptr<const Analyzer> Analyzer::create(const Relation &rel,
+        const std::shared_ptr<const FDTable> &table, const set_str &attribs) {
+    unsigned int size = table->getDictionary().size();
+    if (size <= 64)
+        return std::make_shared<const BasicAnalyzer<FixedAttrSet<64> > >(rel, table, attribs);
+    if (size <= 128)
+        return std::make_shared<const BasicAnalyzer<FixedAttrSet<128> > >(rel, table, attribs);
+    if (size <= 256)
+        return std::make_shared<const BasicAnalyzer<FixedAttrSet<256> > >(rel, table, attribs);
+    if (size <= 512)
+        return std::make_shared<const BasicAnalyzer<FixedAttrSet<512> > >(rel, table, attribs);
+    return std::make_shared<const BasicAnalyzer<AttrSet> >(rel, table, attribs);
+}
@@ -0,0 +1,180 @@
+/*! \file analyzer.h
+ *
+ * \brief Includes declaration for the class Analyzer and its members.
+ *
+ * \details
+ * This file declares the definition of the abstract class Analyzer along with
+ * its subsequent data members and the member functions prototype.
+ *
+ */
+#ifndef ANALYZER_H
+#define ANALYZER_H
+
+#include "declaration.h"
+#include "attribute_dictionary.h"
+#include "fd_table.h"
+#include "key_search.h"
+
+#include <memory>
+#include <vector>
+
+/*!
+ * \class Analyzer
+ * \brief The Analyzer class is the interface to the identifier form of a
+ * Relation used by the analysis methods.
+ * \details The Analyzer shares the FDTable of the relation when it is created,
+ * and the analysis methods read the rows of the dependencies and the
+ * identifiers of the attributes from the table, so the dependencies are not
+ * copied into another form. The analysis methods are implemented by the class
+ * template BasicAnalyzer, which is instantiated for the different types of the
+ * attribute set. The static method Analyzer::create selects the smallest
+ * FixedAttrSet which can hold all the attributes of the table, and the AttrSet
+ * for the wide relations. The names are used only at this interface, when the
+ * parameters are received and the result is returned, so the selection is
+ * transparent to the Relation class. The object represents the state of the
+ * relation at the time of the creation, so the Relation class discards it
+ * whenever the relation is modified, and the table is kept alive by the object
+ * as long as it is used. For the same reason the closures calculated by the
+ * object are cached without any further invalidation, and the number of the
+ * cache hits and misses is counted.
+ */
+class Analyzer {
+public:
+
+    static const unsigned int CACHE_SIZE = 4096; /*!< The maximum number of the
+                                                  * closures in the cache*/
+
+    /**
+     * @brief Creates the Analyzer of the smallest width for the relation.
+     */
+    static std::shared_ptr<const Analyzer> create(const Relation &,
+            const std::shared_ptr<const FDTable> &);
+
+    /**
+     * @brief Creates the Analyzer for the projection of the relation on the
+     * given attribute set.
+     */
+    static std::shared_ptr<const Analyzer> create(const Relation &,
+            const std::shared_ptr<const FDTable> &, const set_str &);
+
+    /**
+     * @brief The destructor for the Analyzer class.
+     */
+    virtual ~Analyzer() {
+    }
+
+    /**
+     * @brief A method to get the closure of the given attribute set.
+     */
+    virtual set_str getClosure(const set_str &) const = 0;
+
+    /**
+     * @brief A method to test if the dependency is implied by the dependency
+     * set.
+     */
+    virtual bool implies(const set_str &, const set_str &) const = 0;
+
+    /**
+     * @brief A method to test if the dependencies are implied by the
+     * dependency set.
+     */
+    virtual std::vector<bool> impliesAll(const std::vector<Dependency> &) const = 0;
+
+    /**
+     * @brief A method to get all the candidate key set for the relation.
+     */
+    virtual set_key getCandidatekey(void) const = 0;
+
+    /**
+     * @brief A method to get the candidate keys found within the limits.
+     */
+    virtual KeySearchResult getCandidatekey(const KeySearchOptions &) const = 0;
+
+    /**
+     * @brief A method to get a single candidate key of the relation.
+     */
+    virtual set_str getAnyCandidateKey(void) const = 0;
+
+    /**
+     * @brief A method to get the candidate key at the given position, in the
+     * order the keys are found.
+     */
+    virtual bool getKey(unsigned int, set_str &) const = 0;
+
+    /**
+     * @brief A method to test if the given attribute set is the super-key.
+     */
+    virtual bool isSuperkey(const set_str &) const = 0;
+
+    /**
+     * @brief A method to test if the given attribute sets are the super-keys.
+     */
+    virtual std::vector<bool> isSuperkey(const std::vector<set_str> &) const = 0;
+
+    /**
+     * @brief A method to test if the given attribute set is the partial-key.
+     */
+    virtual bool isPartialkey(const set_str &) const = 0;
+
+    /**
+     * @brief A method to test if every attribute of the given attribute set
+     * is a prime attribute.
+     */
+    virtual bool isPrime(const set_str &) const = 0;
+
+    /**
+     * @brief A method to get all the prime attributes of the relation.
+     */
+    virtual set_str getPrimeAttributes(void) const = 0;
+
+    /**
+     * @brief A method to retrieve the number of attributes the attribute set
+     * type can hold, or zero if the attribute set type is not of fixed width.
+     */
+    virtual unsigned int getWidth(void) const = 0;
+
+    /**
+     * @brief A getter method to retrieve the dictionary of the attributes.
+     * @return The constant reference of the AttributeDictionary of the relation.
+     */
+    const AttributeDictionary& getDictionary() const {
+        return dictionary;
+    }
+
+    /**
+     * @brief A getter method to retrieve the number of the closures found in
+     * the cache.
+     * @return The number of the cache hits.
+     */
+    unsigned long getCacheHits() const {
+        return hits;
+    }
+
+    /**
+     * @brief A getter method to retrieve the number of the closures which are
+     * calculated because they are not found in the cache.
+     * @return The number of the cache misses.
+     */
+    unsigned long getCacheMisses() const {
+        return misses;
+    }
+
+protected:
+
+    /**
+     * @brief Initializes the Analyzer with the FDTable of the relation.
+     * @param table the table of the dependencies of the relation, whose
+     * dictionary contains all the attributes of the relation.
+     */
+    explicit Analyzer(const std::shared_ptr<const FDTable> &table) :
+    table(table), dictionary(table->getDictionary()), hits(0), misses(0) {
+    }
+
+    std::shared_ptr<const FDTable> table; /*!< The rows of the dependencies*/
+    const AttributeDictionary &dictionary; /*!< The dictionary of all the
+                                            * attributes, owned by the table*/
+    mutable unsigned long hits; /*!< The number of the cache hits*/
+    mutable unsigned long misses; /*!< The number of the cache misses*/
+};
+
+#endif /* ANALYZER_H */
@@ -0,0 +1,70 @@
+/*! \file arena.cc
+ *
+ * \brief Includes definitions of the Arena class members defined in the
+ * arena.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * Arena.
+ *
+ */
+#include "arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ *
+ * @param size the size of the first block in bytes.
+ * @details No memory is obtained until the first allocation, so an unused
+ * arena costs nothing.
+ */
+Arena::Arena(std::size_t size) : current(0), left(0), initial(std::max<std::size_t>(size, 64)),
+next(initial), allocated(0) {
+}
+
+Arena::~Arena() {
+    release();
+}
+
+/**
+ *
+ * @param bytes the number of the bytes to allocate.
+ * @param align the alignment of the memory, a power of two not greater than the
+ * alignment of the global allocator.
+ * @return The pointer to the allocated memory.
+ * @details The current block is used if the aligned request fits into its
+ * free bytes, otherwise a new block is obtained and the free bytes of the
+ * current one are abandoned.
+ */
+void* Arena::allocate(std::size_t bytes, std::size_t align) {
+    std::size_t pad = (align - reinterpret_cast<std::uintptr_t> (current) % align) % align;
+    if (!current || pad + bytes > left) {
+        std::size_t size = std::max(next, bytes);
+        blocks.push_back(new char[size]);
+        current = blocks.back();
+        left = size;
+        pad = 0;
+        if (size == next)
+            next *= 2;
+    }
+    void *ret = current + pad;
+    current += pad + bytes;
+    left -= pad + bytes;
+    allocated += bytes;
+    return ret;
+}
+
+/**
+ * @details The size of the next block is reset to the size of the first one.
+ */
+void Arena::release(void) {
+    for (char *b : blocks) {
+        delete[] b;
+    }
+    blocks.clear();
+    current = 0;
+    left = 0;
+    next = initial;
+    allocated = 0;
+}
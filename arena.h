@@ -0,0 +1,159 @@
+/*! \file arena.h
+ *
+ * \brief Includes declaration for the class Arena, the class template
+ * ArenaAllocator and their members.
+ *
+ * \details
+ * This file declares the definition of the class Arena along with its
+ * subsequent data members and the member functions prototype, and defines the
+ * allocator which draws the memory of a standard container from an Arena.
+ *
+ */
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <vector>
+
+/*!
+ * \class Arena
+ * \brief The Arena class is a monotonic memory resource for the temporary
+ * objects of a single analysis call.
+ * \details The memory is handed out from large blocks by advancing a pointer,
+ * and it is never returned piece by piece. All the blocks are released at once
+ * when the arena is released or destroyed, so the nodes of a temporary set cost
+ * neither a call of the global allocator nor a lock of it when several threads
+ * run the analysis. Every new block is twice the size of the previous one, and
+ * a request larger than the next block gets a block of its own. The arena is
+ * not synchronized, so it must be used by one thread at a time, and the objects
+ * allocated from it must not outlive it.
+ */
+class Arena {
+public:
+
+    /**
+     * @brief Constructs the arena without any block.
+     */
+    explicit Arena(std::size_t size = 4096);
+
+    /**
+     * @brief Destructor of the Arena class, releasing all the blocks.
+     */
+    ~Arena();
+
+    Arena(const Arena &) = delete;
+    Arena& operator=(const Arena &) = delete;
+
+    /**
+     * @brief A method to allocate the memory from the current block.
+     */
+    void* allocate(std::size_t, std::size_t);
+
+    /**
+     * @brief A method to release all the blocks at once.
+     */
+    void release(void);
+
+    /**
+     * @brief A getter method to retrieve the number of the allocated bytes.
+     * @return The total size of the requests since the last release.
+     */
+    std::size_t getAllocated(void) const {
+        return allocated;
+    }
+
+    /**
+     * @brief A getter method to retrieve the number of the blocks.
+     * @return The number of the blocks obtained since the last release.
+     */
+    std::size_t getBlocks(void) const {
+        return blocks.size();
+    }
+
+private:
+    std::vector<char*> blocks; /*!< The blocks obtained from the global heap*/
+    char *current; /*!< The first free byte of the last block*/
+    std::size_t left; /*!< The number of the free bytes of the last block*/
+    std::size_t initial; /*!< The size of the first block*/
+    std::size_t next; /*!< The size of the next block*/
+    std::size_t allocated; /*!< The total size of the requests*/
+};
+
+/*!
+ * \class ArenaAllocator
+ * \brief The ArenaAllocator class template is the allocator of the standard
+ * containers which draws the memory from an Arena.
+ * \details The deallocation does nothing, the memory is reclaimed when the
+ * arena is released. Two allocators are equal if they use the same arena, so a
+ * container can swap or move its nodes only into a container of the same arena.
+ * \tparam T The type of the allocated objects.
+ */
+template <class T>
+class ArenaAllocator {
+public:
+    typedef T value_type; /*!< The type of the allocated objects*/
+
+    /**
+     * @brief Constructs the allocator for the arena.
+     * @param arena the arena from which the memory is drawn.
+     */
+    explicit ArenaAllocator(Arena &arena) : arena(&arena) {
+    }
+
+    /**
+     * @brief Constructs the allocator using the same arena as the parameter.
+     * @param other the allocator of another type.
+     */
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.getArena()) {
+    }
+
+    /**
+     * @brief A method to allocate the memory of the objects.
+     * @param n the number of the objects.
+     * @return The pointer to the memory of the first object.
+     */
+    T* allocate(std::size_t n) {
+        return static_cast<T*> (arena->allocate(n * sizeof (T), alignof(T)));
+    }
+
+    /**
+     * @brief A method to deallocate the memory of the objects, which does
+     * nothing as the memory is reclaimed with the arena.
+     */
+    void deallocate(T *, std::size_t) {
+    }
+
+    /**
+     * @brief A getter method to retrieve the arena of the allocator.
+     * @return The pointer to the arena.
+     */
+    Arena* getArena(void) const {
+        return arena;
+    }
+
+private:
+    Arena *arena; /*!< The arena from which the memory is drawn*/
+};
+
+/**
+ * @brief The overloaded relational operator == to check whether the allocators
+ * use the same arena.
+ * @return true if the memory of one can be deallocated by the other.
+ */
+template <class T, class U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+    return a.getArena() == b.getArena();
+}
+
+/**
+ * @brief The overloaded relational operator != to check whether the allocators
+ * use different arenas.
+ * @return true if the allocators use different arenas.
+ */
+template <class T, class U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+    return a.getArena() != b.getArena();
+}
+
+#endif /* ARENA_H */
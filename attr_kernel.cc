@@ -0,0 +1,256 @@
+/*! \file attr_kernel.cc
+ *
+ * \brief Includes definitions of the AttrKernel struct members defined in the
+ * attr_kernel.h file
+ *
+ * \details
+ * This file contains the scalar, SSE2 and AVX2 implementations of the
+ * functions of the AttrKernel and the selection of the implementation at the
+ * runtime. The vectorized implementations are compiled only for the x86
+ * processors, using the target attribute of the GCC so the rest of the program
+ * does not require the instruction set.
+ *
+ */
+#include "attr_kernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define ATTR_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+typedef AttrKernel::word word;
+
+/*********Scalar implementation*********/
+
+static bool scalarIncludes(const word *lhs, const word *rhs, unsigned int n) {
+    for (unsigned int i = 0; i < n; ++i) {
+        if (rhs[i] & ~lhs[i])
+            return false;
+    }
+    return true;
+}
+
+static bool scalarEqual(const word *lhs, const word *rhs, unsigned int n) {
+    for (unsigned int i = 0; i < n; ++i) {
+        if (lhs[i] != rhs[i])
+            return false;
+    }
+    return true;
+}
+
+static void scalarUnite(word *lhs, const word *rhs, unsigned int n) {
+    for (unsigned int i = 0; i < n; ++i) {
+        lhs[i] |= rhs[i];
+    }
+}
+
+static void scalarSubtract(word *lhs, const word *rhs, unsigned int n) {
+    for (unsigned int i = 0; i < n; ++i) {
+        lhs[i] &= ~rhs[i];
+    }
+}
+
+static unsigned int scalarCount(const word *set, unsigned int n) {
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < n; ++i) {
+        count += __builtin_popcountll(set[i]);
+    }
+    return count;
+}
+
+static unsigned int scalarCovered(const word *x, const word *rows,
+        unsigned int n, unsigned int count) {
+    for (unsigned int r = 0; r < count; ++r, rows += n) {
+        if (scalarIncludes(x, rows, n))
+            return r;
+    }
+    return count;
+}
+
+static const AttrKernel SCALAR = {
+    "scalar", scalarIncludes, scalarEqual, scalarUnite, scalarSubtract,
+    scalarCount, scalarCovered
+};
+
+#ifdef ATTR_KERNEL_X86
+
+/*********SSE2 implementation, two words at a time*********/
+
+__attribute__((target("sse2")))
+static inline bool sse2Zero(__m128i v) {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) == 0xFFFF;
+}
+
+__attribute__((target("sse2")))
+static bool sse2Includes(const word *lhs, const word *rhs, unsigned int n) {
+    unsigned int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (lhs + i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (rhs + i));
+        if (!sse2Zero(_mm_andnot_si128(a, b)))
+            return false;
+    }
+    return scalarIncludes(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static bool sse2Equal(const word *lhs, const word *rhs, unsigned int n) {
+    unsigned int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (lhs + i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (rhs + i));
+        if (!sse2Zero(_mm_xor_si128(a, b)))
+            return false;
+    }
+    return scalarEqual(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static void sse2Unite(word *lhs, const word *rhs, unsigned int n) {
+    unsigned int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (lhs + i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (rhs + i));
+        _mm_storeu_si128((__m128i *) (lhs + i), _mm_or_si128(a, b));
+    }
+    scalarUnite(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static void sse2Subtract(word *lhs, const word *rhs, unsigned int n) {
+    unsigned int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (lhs + i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (rhs + i));
+        _mm_storeu_si128((__m128i *) (lhs + i), _mm_andnot_si128(b, a));
+    }
+    scalarSubtract(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static unsigned int sse2Covered(const word *x, const word *rows,
+        unsigned int n, unsigned int count) {
+    for (unsigned int r = 0; r < count; ++r, rows += n) {
+        if (sse2Includes(x, rows, n))
+            return r;
+    }
+    return count;
+}
+
+static const AttrKernel SSE2 = {
+    "sse2", sse2Includes, sse2Equal, sse2Unite, sse2Subtract,
+    scalarCount, sse2Covered
+};
+
+/*********AVX2 implementation, four words at a time*********/
+
+__attribute__((target("avx2")))
+static bool avx2Includes(const word *lhs, const word *rhs, unsigned int n) {
+    unsigned int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (lhs + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (rhs + i));
+        __m256i t = _mm256_andnot_si256(a, b);
+        if (!_mm256_testz_si256(t, t))
+            return false;
+    }
+    return scalarIncludes(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static bool avx2Equal(const word *lhs, const word *rhs, unsigned int n) {
+    unsigned int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (lhs + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (rhs + i));
+        __m256i t = _mm256_xor_si256(a, b);
+        if (!_mm256_testz_si256(t, t))
+            return false;
+    }
+    return scalarEqual(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void avx2Unite(word *lhs, const word *rhs, unsigned int n) {
+    unsigned int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (lhs + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (rhs + i));
+        _mm256_storeu_si256((__m256i *) (lhs + i), _mm256_or_si256(a, b));
+    }
+    scalarUnite(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void avx2Subtract(word *lhs, const word *rhs, unsigned int n) {
+    unsigned int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (lhs + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (rhs + i));
+        _mm256_storeu_si256((__m256i *) (lhs + i), _mm256_andnot_si256(b, a));
+    }
+    scalarSubtract(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("popcnt")))
+static unsigned int popcntCount(const word *set, unsigned int n) {
+    unsigned int c0 = 0, c1 = 0, c2 = 0, c3 = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        c0 += __builtin_popcountll(set[i]);
+        c1 += __builtin_popcountll(set[i + 1]);
+        c2 += __builtin_popcountll(set[i + 2]);
+        c3 += __builtin_popcountll(set[i + 3]);
+    }
+    for (; i < n; ++i) {
+        c0 += __builtin_popcountll(set[i]);
+    }
+    return c0 + c1 + c2 + c3;
+}
+
+__attribute__((target("avx2")))
+static unsigned int avx2Covered(const word *x, const word *rows,
+        unsigned int n, unsigned int count) {
+    for (unsigned int r = 0; r < count; ++r, rows += n) {
+        if (avx2Includes(x, rows, n))
+            return r;
+    }
+    return count;
+}
+
+static const AttrKernel AVX2 = {
+    "avx2", avx2Includes, avx2Equal, avx2Unite, avx2Subtract,
+    popcntCount, avx2Covered
+};
+
+#endif /* ATTR_KERNEL_X86 */
+
+/**
+ *
+ * @return The constant reference of the AttrKernel implementation selected for
+ * the processor.
+ * @details The selection is performed only once, on the first call. The AVX2
+ * implementation is selected if the processor supports the AVX2 and POPCNT
+ * instructions, otherwise the SSE2 implementation is selected on the x86
+ * processors and the scalar implementation on all other processors.
+ */
+const AttrKernel& AttrKernel::get(void) {
+    static const AttrKernel &kernel = []() -> const AttrKernel& {
+#ifdef ATTR_KERNEL_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+            return AVX2;
+        if (__builtin_cpu_supports("sse2"))
+            return SSE2;
+#endif
+        return SCALAR;
+    }();
+    return kernel;
+}
+
+/**
+ *
+ * @return The constant reference of the scalar AttrKernel implementation.
+ */
+const AttrKernel& AttrKernel::scalar(void) {
+    return SCALAR;
+}
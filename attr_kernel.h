@@ -0,0 +1,61 @@
+/*! \file attr_kernel.h
+ *
+ * \brief Includes declaration for the struct AttrKernel and its members.
+ *
+ * \details
+ * This file declares the definition of the struct AttrKernel, the table of the
+ * functions which perform the set operations on the bit-packed attribute sets.
+ *
+ */
+#ifndef ATTR_KERNEL_H
+#define ATTR_KERNEL_H
+
+/*!
+ * \struct AttrKernel
+ * \brief The AttrKernel struct is a table of the functions implementing the
+ * operations on the arrays of words of the bit-packed attribute sets.
+ * \details There are different implementations of the table, a scalar one which
+ * works on every platform and the vectorized ones using the SSE2 and AVX2
+ * instructions of the x86 processors. The static method AttrKernel::get selects
+ * the best implementation supported by the processor at the runtime, using the
+ * CPUID instruction. All the functions works on the arrays of n words, and the
+ * arrays need not to be aligned.
+ */
+struct AttrKernel {
+    typedef unsigned long long word; /*!< The type of a single word of bits*/
+
+    const char *name; /*!< The name of the implementation*/
+
+    /*! Checks whether every bit of rhs is also set in lhs.*/
+    bool (*includes)(const word *lhs, const word *rhs, unsigned int n);
+
+    /*! Checks whether both the arrays have same bits.*/
+    bool (*equal)(const word *lhs, const word *rhs, unsigned int n);
+
+    /*! Sets all the bits of rhs in the lhs, the union of the sets.*/
+    void (*unite)(word *lhs, const word *rhs, unsigned int n);
+
+    /*! Clears all the bits of rhs from the lhs, the and-not of the sets.*/
+    void (*subtract)(word *lhs, const word *rhs, unsigned int n);
+
+    /*! Counts the number of bits set in the array.*/
+    unsigned int (*count)(const word *set, unsigned int n);
+
+    /*! Finds the first of the rows, stored one after another with n words
+     * each, whose bits are all set in x. Returns the index of the row, or the
+     * number of rows if no row is covered by x.*/
+    unsigned int (*covered)(const word *x, const word *rows, unsigned int n,
+            unsigned int count);
+
+    /**
+     * @brief Retrieves the best implementation supported by the processor.
+     */
+    static const AttrKernel& get(void);
+
+    /**
+     * @brief Retrieves the scalar implementation.
+     */
+    static const AttrKernel& scalar(void);
+};
+
+#endif /* ATTR_KERNEL_H */
@@ -0,0 +1,219 @@
+/*! \file attr_set.cc
+ *
+ * \brief Includes definitions of the AttrSet class members defined in the
+ * attr_set.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * AttrSet.
+ *
+ */
+#include "attr_set.h"
+#include "attr_kernel.h"
+
+#include <algorithm>
+
+/*!
+  \def KERNEL
+  Defines the AttrKernel implementation selected for the processor, used for 
+  the operations on the words of the sets.
+ */
+#define KERNEL AttrKernel::get()
+
+const unsigned int AttrSet::BITS;
+const unsigned int AttrSet::npos;
+
+/**
+ *
+ * @param capacity the number of identifiers for which the space is reserved.
+ * Default value is zero, in which case the vector grows on first insert.
+ */
+AttrSet::AttrSet(unsigned int capacity) :
+words((capacity + BITS - 1) / BITS, 0) {
+}
+
+/**
+ *
+ * @param id the identifier to add.
+ * @return true if the identifier is inserted, false otherwise - meaning that
+ * the identifier is already present in the set.
+ */
+bool AttrSet::insert(unsigned int id) {
+    if (id / BITS >= words.size())
+        words.resize(id / BITS + 1, 0);
+    word mask = (word) 1 << (id % BITS);
+    if (words[id / BITS] & mask)
+        return false;
+    words[id / BITS] |= mask;
+    return true;
+}
+
+/**
+ *
+ * @param id the identifier to remove.
+ * @return true if the identifier is removed, false otherwise - meaning that
+ * the identifier is not present in the set.
+ */
+bool AttrSet::erase(unsigned int id) {
+    if (!contains(id))
+        return false;
+    words[id / BITS] &= ~((word) 1 << (id % BITS));
+    return true;
+}
+
+/**
+ *
+ * @param right the set which is to be tested as subset of the current set.
+ * @return true if all the identifiers from the parameter are present in the set,
+ * false otherwise.
+ */
+bool AttrSet::includes(const AttrSet &right) const {
+    unsigned int n = std::min(words.size(), right.words.size());
+    if (!KERNEL.includes(words.data(), right.words.data(), n))
+        return false;
+    for (unsigned int i = n; i < right.words.size(); ++i) {
+        if (right.words[i])
+            return false;
+    }
+    return true;
+}
+
+/**
+ *
+ * @param right the set to test against.
+ * @return true if at least one identifier is present in both sets, false
+ * otherwise.
+ */
+bool AttrSet::intersects(const AttrSet &right) const {
+    unsigned int n = std::min(words.size(), right.words.size());
+    for (unsigned int i = 0; i < n; ++i) {
+        if (words[i] & right.words[i])
+            return true;
+    }
+    return false;
+}
+
+/**
+ *
+ * @return The number of identifiers present in the set.
+ */
+unsigned int AttrSet::size(void) const {
+    return KERNEL.count(words.data(), words.size());
+}
+
+/**
+ *
+ * @return true if no identifier is present in the set, false otherwise.
+ */
+bool AttrSet::empty(void) const {
+    for (word w : words) {
+        if (w)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @details The capacity of the set is retained.
+ */
+void AttrSet::clear(void) {
+    std::fill(words.begin(), words.end(), 0);
+}
+
+/**
+ *
+ * @param id the identifier from which the search starts.
+ * @return The smallest identifier present in the set which is greater than or
+ * equal to the parameter, or AttrSet::npos if there is no such identifier.
+ * @details Together with AttrSet::first the method is used to iterate over the
+ * identifiers in the increasing order.
+ */
+unsigned int AttrSet::next(unsigned int id) const {
+    unsigned int i = id / BITS;
+    if (i >= words.size())
+        return npos;
+    word w = words[i] & (~(word) 0 << (id % BITS));
+    while (!w) {
+        if (++i >= words.size())
+            return npos;
+        w = words[i];
+    }
+    return i * BITS + __builtin_ctzll(w);
+}
+
+/**
+ *
+ * @param right the set whose identifiers are to be added.
+ * @return The reference of the current set.
+ */
+AttrSet& AttrSet::operator|=(const AttrSet &right) {
+    if (words.size() < right.words.size())
+        words.resize(right.words.size(), 0);
+    KERNEL.unite(words.data(), right.words.data(), right.words.size());
+    return *this;
+}
+
+/**
+ *
+ * @param right the set whose identifiers are to be kept.
+ * @return The reference of the current set.
+ */
+AttrSet& AttrSet::operator&=(const AttrSet &right) {
+    for (unsigned int i = 0; i < words.size(); ++i) {
+        words[i] &= right.at(i);
+    }
+    return *this;
+}
+
+/**
+ *
+ * @param right the set whose identifiers are to be removed.
+ * @return The reference of the current set.
+ */
+AttrSet& AttrSet::operator-=(const AttrSet &right) {
+    KERNEL.subtract(words.data(), right.words.data(),
+            std::min(words.size(), right.words.size()));
+    return *this;
+}
+
+/**
+ *
+ * @param right parameter to represent the rhs set to test equality.
+ * @return true if the both sets contains same identifiers, false otherwise.
+ * @details The capacity of the sets is not considered for the equality.
+ */
+bool AttrSet::operator==(const AttrSet &right) const {
+    unsigned int n = std::min(words.size(), right.words.size());
+    if (!KERNEL.equal(words.data(), right.words.data(), n))
+        return false;
+    const std::vector<word> &longer = words.size() > n ? words : right.words;
+    for (unsigned int i = n; i < longer.size(); ++i) {
+        if (longer[i])
+            return false;
+    }
+    return true;
+}
+
+/**
+ *
+ * @param right parameter to represent the rhs set to test less inequality.
+ * @return true if the current set is logical lesser than the parameter, false
+ * otherwise.
+ * @details Same as setstr_compare::less, the smaller set is considered lesser.
+ * The sets of the same size are compared by their smallest differing identifier
+ * and the set which contains it is lesser.
+ */
+bool AttrSet::operator<(const AttrSet &right) const {
+    unsigned int ls = size(), rs = right.size();
+    if (ls != rs)
+        return ls < rs;
+    unsigned int n = std::max(words.size(), right.words.size());
+    for (unsigned int i = 0; i < n; ++i) {
+        word diff = at(i) ^ right.at(i);
+        if (diff)
+            return (at(i) & diff & -diff) != 0;
+    }
+    return false;
+}
+
+#undef KERNEL
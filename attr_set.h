@@ -0,0 +1,192 @@
+/*! \file attr_set.h
+ *
+ * \brief Includes declaration for the class AttrSet and its members.
+ *
+ * \details
+ * This file declares the definition of the class AttrSet along with its
+ * subsequent data members and the member functions prototype. It also defines
+ * the overloaded versions of the global functions isSubset, isEqual and
+ * contains for the AttrSet objects.
+ *
+ */
+#ifndef ATTR_SET_H
+#define ATTR_SET_H
+
+#include "declaration.h"
+
+#include <vector>
+
+/*!
+ * \class AttrSet
+ * \brief The AttrSet class represents a set of attribute identifiers as a
+ * contiguous bit vector.
+ * \details The attribute with the identifier i is present in the set if the
+ * bit i of the vector is set. The set operations like subset test, union,
+ * difference and equality are performed on a complete word of bits at a time,
+ * so they need only few bit operations instead of walking the nodes of a tree.
+ * The vector is extended automatically when an identifier beyond its current
+ * capacity is inserted, and two sets with different capacity can be used in
+ * the same operation, missing words are considered as empty.
+ * The operations on the words are performed by the AttrKernel selected for
+ * the processor, so the wide sets are processed by the SIMD instructions.
+ */
+class AttrSet {
+public:
+
+    typedef unsigned long long word; /*!< The type of a single word of bits*/
+
+    static const unsigned int BITS = 64; /*!< The number of bits in a word*/
+
+    static const unsigned int npos = ~0u; /*!< The value returned when no more
+                                           * identifier is found*/
+
+    /**
+     * @brief Constructs the empty set with the capacity for the given number
+     * of identifiers.
+     */
+    explicit AttrSet(unsigned int capacity = 0);
+
+    /**
+     * @brief A method to add an identifier to the set.
+     */
+    bool insert(unsigned int);
+
+    /**
+     * @brief A method to remove an identifier from the set.
+     */
+    bool erase(unsigned int);
+
+    /**
+     * @brief A method to check whether the identifier is present in the set.
+     * @param id the identifier to search for.
+     * @return true if the identifier is present, false otherwise.
+     */
+    bool contains(unsigned int id) const {
+        return id / BITS < words.size()
+                && (words[id / BITS] >> (id % BITS) & 1);
+    }
+
+    /**
+     * @brief A method to check whether every identifier of the parameter is
+     * present in the set.
+     */
+    bool includes(const AttrSet &) const;
+
+    /**
+     * @brief A method to check whether the set and the parameter have any
+     * common identifier.
+     */
+    bool intersects(const AttrSet &) const;
+
+    /**
+     * @brief A method to calculate the number of identifiers in the set.
+     */
+    unsigned int size(void) const;
+
+    /**
+     * @brief A method to check whether the set is empty.
+     */
+    bool empty(void) const;
+
+    /**
+     * @brief A method to remove all the identifiers from the set.
+     */
+    void clear(void);
+
+    /**
+     * @brief A method to find the next identifier present in the set.
+     */
+    unsigned int next(unsigned int) const;
+
+    /**
+     * @brief A method to find the smallest identifier present in the set.
+     * @return The smallest identifier, or AttrSet::npos if the set is empty.
+     */
+    unsigned int first(void) const {
+        return next(0);
+    }
+
+    /**
+     * @brief The overloaded operator |= to add all the identifiers of the
+     * parameter to the set.
+     */
+    AttrSet& operator|=(const AttrSet &);
+
+    /**
+     * @brief The overloaded operator &= to keep only the identifiers which are
+     * present in the parameter.
+     */
+    AttrSet& operator&=(const AttrSet &);
+
+    /**
+     * @brief The overloaded operator -= to remove all the identifiers of the
+     * parameter from the set.
+     */
+    AttrSet& operator-=(const AttrSet &);
+
+    /**
+     * @brief The overloaded relational operator == to check equality between
+     * the two AttrSet objects.
+     */
+    bool operator==(const AttrSet &) const;
+
+    /**
+     * @brief The overloaded relational operator != to check inequality between
+     * the two AttrSet objects.
+     */
+    bool operator!=(const AttrSet &right) const {
+        return !(*this == right);
+    }
+
+    /**
+     * @brief The overloaded less operator for ordering the AttrSet objects.
+     */
+    bool operator<(const AttrSet &) const;
+
+private:
+    std::vector<word> words; /*!< The words of the bit vector*/
+
+    /**
+     * @brief Retrieves the word at the given index, or zero if the index is
+     * beyond the capacity.
+     */
+    word at(unsigned int i) const {
+        return i < words.size() ? words[i] : 0;
+    }
+};
+
+/**
+ * @brief Checks whether the second parameter is subset of the first parameter.
+ * @param lhs the AttrSet object from which the second parameter is to be look up.
+ * @param rhs the AttrSet object which is to be tested as subset of the first
+ * parameter.
+ * @return true if the rhs is subset of the lhs, false otherwise.
+ * @details A alternate version of the template function isSubset for AttrSet.
+ */
+inline bool isSubset(const AttrSet &lhs, const AttrSet &rhs) {
+    return lhs.includes(rhs);
+}
+
+/**
+ * @brief Checks the equality of two AttrSet objects.
+ * @param lhs is the AttrSet object that represents first parameter.
+ * @param rhs is the AttrSet object that represents second parameter
+ * @return true if both sets are equal, false otherwise.
+ * @details A alternate version of the template function isEqual for AttrSet.
+ */
+inline bool isEqual(const AttrSet &lhs, const AttrSet &rhs) {
+    return lhs == rhs;
+}
+
+/**
+ * @brief Checks whether the identifier is present in the AttrSet object.
+ * @param list A constant AttrSet to check from.
+ * @param val The identifier representing the search value.
+ * @return true for successful find false otherwise.
+ * @details A alternate version of the template function contains for AttrSet.
+ */
+inline bool contains(const AttrSet &list, unsigned int val) {
+    return list.contains(val);
+}
+
+#endif /* ATTR_SET_H */
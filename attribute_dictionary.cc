@@ -0,0 +1,51 @@
+/*! \file attribute_dictionary.cc
+ *
+ * \brief Includes definitions of the AttributeDictionary class members defined
+ * in the attribute_dictionary.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * AttributeDictionary.
+ *
+ */
+#include "attribute_dictionary.h"
+
+/**
+ *
+ * @param str the constant string reference representing the attribute name.
+ * @return The identifier of the attribute name. If the name is already present
+ * in the dictionary then its existing identifier is returned, otherwise the name
+ * is added with the next free identifier.
+ */
+unsigned int AttributeDictionary::intern(const string &str) {
+    auto res = ids.insert(std::make_pair(str, (unsigned int) names.size()));
+    if (res.second)
+        names.push_back(str);
+    return res.first->second;
+}
+
+/**
+ *
+ * @param as the attribute set whose names are to be interned.
+ * @details The names are interned in the order of the set, so the identifiers
+ * of new names follows the order of the strings.
+ */
+void AttributeDictionary::intern(const set_str &as) {
+    for (const string &str : as) {
+        intern(str);
+    }
+}
+
+/**
+ *
+ * @param str the attribute name to search for.
+ * @param id the reference where the identifier is stored if the name is found.
+ * @return true if the name is present in the dictionary, false otherwise.
+ */
+bool AttributeDictionary::find(const string &str, unsigned int &id) const {
+    auto i = ids.find(str);
+    if (i == ids.end())
+        return false;
+    id = i->second;
+    return true;
+}
@@ -0,0 +1,70 @@
+/*! \file attribute_dictionary.h
+ *
+ * \brief Includes declaration for the class AttributeDictionary and its members.
+ *
+ * \details
+ * This file declares the definition of the class AttributeDictionary along with
+ * its subsequent data members and the member functions prototype.
+ *
+ */
+#ifndef ATTRIBUTE_DICTIONARY_H
+#define ATTRIBUTE_DICTIONARY_H
+
+#include "declaration.h"
+
+#include <vector>
+#include <unordered_map>
+
+/*!
+ * \class AttributeDictionary
+ * \brief The AttributeDictionary class maps the attribute names of a relation
+ * to dense integer identifiers.
+ * \details Every attribute name is interned only once and receives the next
+ * free identifier starting from zero. The analysis methods can then work on the
+ * identifiers instead of comparing the strings, and the names are retrieved
+ * back only when the result is returned to the caller. When the attributes are
+ * interned in the order of a set_str, the order of the identifiers is same as
+ * the order of the names.
+ */
+class AttributeDictionary {
+public:
+
+    /**
+     * @brief Interns a single attribute name into the dictionary.
+     */
+    unsigned int intern(const string &);
+
+    /**
+     * @brief Interns all the attribute names from the attribute set.
+     */
+    void intern(const set_str &);
+
+    /**
+     * @brief Finds the identifier of the attribute name.
+     */
+    bool find(const string &, unsigned int &) const;
+
+    /**
+     * @brief Retrieves the attribute name for the identifier.
+     * @param id the identifier of the attribute.
+     * @return The constant reference to the attribute name.
+     */
+    const string& getName(unsigned int id) const {
+        return names[id];
+    }
+
+    /**
+     * @brief Retrieves the number of the interned attributes.
+     * @return The total number of attribute names in the dictionary.
+     */
+    unsigned int size(void) const {
+        return names.size();
+    }
+
+private:
+    std::unordered_map<string, unsigned int> ids; /*!< The map from the attribute
+                                                   * name to its identifier*/
+    std::vector<string> names; /*!< The attribute names indexed by identifier*/
+};
+
+#endif /* ATTRIBUTE_DICTIONARY_H */
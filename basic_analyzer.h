@@ -0,0 +1,340 @@
+/*! \file basic_analyzer.h
+ *
+ * \brief Includes declaration for the class template BasicAnalyzer and its
+ * members.
+ *
+ * \details
+ * This file declares the definition of the class template BasicAnalyzer along
+ * with its subsequent data members and the member functions prototype. It
+ * includes the file basic_analyzer_def.h which includes the definition of the
+ * member functions.
+ *
+ */
+#ifndef BASIC_ANALYZER_H
+#define BASIC_ANALYZER_H
+
+#include "declaration.h"
+#include "relation.h"
+#include "analyzer.h"
+#include "attr_set.h"
+#include "fixed_attr_set.h"
+#include "set_trie.h"
+#include "arena.h"
+
+#include <vector>
+#include <map>
+#include <chrono>
+
+/*!
+ * \class BasicAnalyzer
+ * \brief The BasicAnalyzer class template implements the analysis methods of
+ * the Analyzer for an attribute set type.
+ * \details The template parameter Set is the type used to represent a set of
+ * attribute identifiers, either a FixedAttrSet or the AttrSet. The attribute
+ * set and the keys are stored in this type, so for the relations with at most
+ * 64 attributes the key search works on a single machine word. The dependencies
+ * are not copied, they are read from the rows of the FDTable shared with the
+ * relation, and only the number of the lhs attributes of every row is kept by
+ * the Analyzer. The closure is calculated by the LINCLOSURE algorithm of Beeri
+ * and Bernstein, using the number of lhs attributes of every row and the
+ * posting lists of the table, so its time is linear in the size of the
+ * dependency set and it reads the rhs rows from the contiguous array. The calculated closures are cached, up to the
+ * Analyzer::CACHE_SIZE entries, as the key search and the normal form tests
+ * calculate the closure of the same attribute set repeatedly. The candidate
+ * keys and the prime attributes are calculated only once, by the algorithm
+ * selected for the relation. The Lucchesi-Osborn algorithm finds the keys one
+ * at a time, so the search is continued only as far as a method requires. The
+ * prime attributes are decided one attribute at a time by a targeted search
+ * for a key containing the attribute, so they usually need only few keys.
+ * Before the search the attributes are classified by the sides of the rules
+ * on which they appear. The attributes which are not on the rhs of any rule
+ * belong to every key, the attributes which are only on the rhs belong to no
+ * key, and only the remaining attributes are searched. The keys are indexed
+ * by a SetTrie, so the test whether a set contains a key or is contained in a
+ * key does not compare the set with every key.
+ */
+template <class Set>
+class BasicAnalyzer : public Analyzer {
+public:
+
+    /**
+     * @brief Constructs the identifier form of the relation.
+     */
+    BasicAnalyzer(const Relation &, const std::shared_ptr<const FDTable> &,
+            const set_str &);
+
+    /**
+     * @brief A method to get the closure of the given attribute set.
+     */
+    set_str getClosure(const set_str &) const;
+
+    /**
+     * @brief A method to test if the dependency is implied by the dependency
+     * set.
+     */
+    bool implies(const set_str &, const set_str &) const;
+
+    /**
+     * @brief A method to test if the dependencies are implied by the
+     * dependency set.
+     */
+    std::vector<bool> impliesAll(const std::vector<Dependency> &) const;
+
+    /**
+     * @brief A method to get all the candidate key set for the relation.
+     */
+    set_key getCandidatekey(void) const;
+
+    /**
+     * @brief A method to get the candidate keys found within the limits.
+     */
+    KeySearchResult getCandidatekey(const KeySearchOptions &) const;
+
+    /**
+     * @brief A method to get a single candidate key of the relation.
+     */
+    set_str getAnyCandidateKey(void) const;
+
+    /**
+     * @brief A method to get the candidate key at the given position.
+     */
+    bool getKey(unsigned int, set_str &) const;
+
+    /**
+     * @brief A method to test if the given attribute set is the super-key.
+     */
+    bool isSuperkey(const set_str &) const;
+
+    /**
+     * @brief A method to test if the given attribute sets are the super-keys.
+     */
+    std::vector<bool> isSuperkey(const std::vector<set_str> &) const;
+
+    /**
+     * @brief A method to test if the given attribute set is the partial-key.
+     */
+    bool isPartialkey(const set_str &) const;
+
+    /**
+     * @brief A method to test if every attribute of the given attribute set
+     * is a prime attribute.
+     */
+    bool isPrime(const set_str &) const;
+
+    /**
+     * @brief A method to get all the prime attributes of the relation.
+     */
+    set_str getPrimeAttributes(void) const;
+
+    /**
+     * @brief A method to retrieve the number of attributes the attribute set
+     * type can hold.
+     */
+    unsigned int getWidth(void) const;
+
+private:
+
+    /*!
+     * \typedef Level
+     * \brief The identifier sets of a level of the key search, whose nodes are
+     * drawn from the Arena of the search. The words of an AttrSet are not
+     * drawn from the Arena, they are allocated by the AttrSet itself.
+     */
+    typedef set<Set, std::less<Set>, ArenaAllocator<Set> > Level;
+
+    typedef FDTable::word word; /*!< The type of a single word of the rows*/
+
+    static const unsigned int BITS = 8 * sizeof (word); /*!< The number of bits
+                                                         * in a word*/
+
+    /*!
+     * \struct Budget
+     * \brief The remaining time and number of the nodes of a limited search.
+     */
+    struct Budget {
+        const KeySearchOptions &options; /*!< The limits of the search*/
+        std::chrono::steady_clock::time_point deadline; /*!< The end of the
+                                                         * time limit*/
+        unsigned long nodes; /*!< The number of the nodes examined so far*/
+        bool exhausted; /*!< Indicates whether a node was refused*/
+
+        /**
+         * @brief Starts the budget of the search.
+         * @param options the limits of the search.
+         */
+        explicit Budget(const KeySearchOptions &options) : options(options),
+        deadline(std::chrono::steady_clock::now()
+        + std::chrono::milliseconds(options.timeLimit)), nodes(0),
+        exhausted(false) {
+        }
+
+        /**
+         * @brief Charges a single node to the budget.
+         * @return true if the node is within the limits, false if the budget
+         * is exhausted.
+         */
+        bool spend(void) {
+            if ((options.maxNodes && nodes >= options.maxNodes)
+                    || (options.timeLimit
+                    && std::chrono::steady_clock::now() >= deadline)) {
+                exhausted = true;
+                return false;
+            }
+            ++nodes;
+            return true;
+        }
+    };
+
+    Relation::KeyEngine engine; /*!< The algorithm of the key calculation*/
+    Set attributes; /*!< The identifiers of the attribute set of the relation*/
+    Set mandatory; /*!< The identifiers which belong to every key*/
+    Set core; /*!< The identifiers which are searched for the keys*/
+    std::vector<word> mask; /*!< The words of the attribute set, which restrict
+                             * the rhs rows*/
+    std::vector<unsigned int> rules; /*!< The indices of the rows of the table
+                                      * which are applied*/
+    std::vector<unsigned int> lhsCount; /*!< The number of lhs identifiers of
+                                         * every row, and one more for the rows
+                                         * which are not applied*/
+    mutable std::map<Set, Set> cache; /*!< The calculated closures*/
+    mutable bool searched; /*!< Indicates whether all the keys are found*/
+    mutable unsigned int nextKey; /*!< The position of the key from which the
+                                   * next key is derived*/
+    mutable unsigned int nextRule; /*!< The position of the rule from which the
+                                    * next key is derived*/
+    mutable std::vector<Set> keys; /*!< The candidate keys found so far*/
+    mutable SetTrie<unsigned int> keyIndex; /*!< The index of the keys*/
+    mutable Set primes; /*!< The union of all the candidate keys*/
+
+    /**
+     * @brief A method to classify the attributes by their role in the rules.
+     */
+    void classify(void);
+
+    /**
+     * @brief A method to get the closure of the identifier set, from the cache
+     * if it is already calculated.
+     */
+    Set closure(const Set &) const;
+
+    /**
+     * @brief A method to calculate the closure of the identifier set.
+     */
+    Set calculateClosure(const Set &) const;
+
+    /**
+     * @brief A method to test if all the identifiers of the second parameter
+     * are in the closure of the first parameter.
+     */
+    bool derives(const Set &, const Set &, std::vector<unsigned int> &) const;
+
+    /**
+     * @brief A method to test if the dependency is implied by the dependency
+     * set, using the given buffer of the rule counters.
+     */
+    bool implies(const set_str &, const set_str &, std::vector<unsigned int> &) const;
+
+    /**
+     * @brief A method to get all the candidate keys as identifier sets,
+     * calculating them on the first call.
+     */
+    const std::vector<Set>& getKeys(void) const;
+
+    /**
+     * @brief A method to search all the candidate keys as identifier sets by
+     * the selected level wise algorithm.
+     */
+    std::vector<Set> searchKeys(void) const;
+
+    /**
+     * @brief A method to search all the candidate keys by the level wise search
+     * of the attribute sets.
+     */
+    std::vector<Set> searchLevelwise(void) const;
+
+    /**
+     * @brief A method to search all the candidate keys by the level wise search
+     * of the attribute sets using multiple threads.
+     */
+    std::vector<Set> searchParallel(void) const;
+
+    /**
+     * @brief A method to search the candidate keys by the level wise search
+     * of the attribute sets within the budget and the size limit.
+     */
+    bool searchBounded(Budget &, KeySearchResult &) const;
+
+    /**
+     * @brief A method to find the next candidate key.
+     */
+    bool findNext(void) const;
+
+    /**
+     * @brief A method to find the next candidate key by the Lucchesi-Osborn
+     * algorithm within the budget.
+     */
+    bool step(Budget *) const;
+
+    /**
+     * @brief A method to add a found candidate key.
+     */
+    void addKey(const Set &) const;
+
+    /**
+     * @brief A method to reduce the super-key into a candidate key.
+     */
+    Set minimize(Set, unsigned int keep = Set::npos, Budget *budget = 0) const;
+
+    /**
+     * @brief A method to decide whether the attribute belongs to any candidate
+     * key.
+     */
+    bool isPrimeAttribute(unsigned int) const;
+
+    /**
+     * @brief Converts the row of the table into the identifier set.
+     */
+    Set toSet(const word *) const;
+
+    /**
+     * @brief Converts the attribute names into the identifier set.
+     */
+    bool toIds(const set_str &, Set &) const;
+
+    /**
+     * @brief Converts the identifier set into the attribute names.
+     */
+    set_str toNames(const Set &) const;
+
+    /**
+     * @brief Converts the identifier set into the vector of the identifiers.
+     */
+    static std::vector<unsigned int> toVector(const Set &);
+
+    /**
+     * @brief A static method to get next possible iteration set for calculating
+     * the candidate key using existing key and the attribute set parameter.
+     */
+    static void getNextIteration(const Level &, const Set &, Level &);
+};
+
+/**
+ * @brief Retrieves the width of the AttrSet type.
+ * @return Zero, as the AttrSet is not of fixed width.
+ */
+inline unsigned int getSetWidth(const AttrSet *) {
+    return 0;
+}
+
+/**
+ * @brief Retrieves the width of the FixedAttrSet type.
+ * @return The number of identifiers the FixedAttrSet can hold.
+ */
+template <unsigned int N>
+inline unsigned int getSetWidth(const FixedAttrSet<N> *) {
+    return N;
+}
+
+#include "basic_analyzer_def.h"
+
+#endif /* BASIC_ANALYZER_H */
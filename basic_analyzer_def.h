@@ -0,0 +1,983 @@
+/*! \file basic_analyzer_def.h
+    \brief Contains the definition for the member functions of the class 
+    template BasicAnalyzer.
+  
+    \details
+    Definition of the member functions of the class template BasicAnalyzer 
+    declared in the basic_analyzer.h file. This file is to be included in the 
+    basic_analyzer.h file.
+ */
+#ifndef BASIC_ANALYZER_DEF_H
+#define BASIC_ANALYZER_DEF_H
+
+#include "relation.h"
+#include "utility.h"
+#include "task_scheduler.h"
+
+#include <algorithm>
+
+/**
+ *
+ * @param rel the relation object whose key engine is used.
+ * @param table the FDTable of the relation, shared with the Analyzer.
+ * @param attribs the attribute set of the relation, or of its projection.
+ * @details The rows of the table are not copied. A row is applied only if its
+ * lhs is part of the attribute set and its rhs, restricted to the attribute 
+ * set, is not empty, so the applied rows are the dependencies of 
+ * Relation::project for a projection. The counter of the other rows starts 
+ * with one more than the number of their lhs attributes, so it never becomes 
+ * zero and the closure skips them without a separate test.
+ */
+template <class Set>
+BasicAnalyzer<Set>::BasicAnalyzer(const Relation &rel,
+        const std::shared_ptr<const FDTable> &table, const set_str &attribs) :
+Analyzer(table), engine(rel.getKeyEngine()),
+attributes(dictionary.size()), mandatory(dictionary.size()),
+core(dictionary.size()), mask(table->getWords(), 0), searched(false),
+nextKey(0), nextRule(0), primes(dictionary.size()) {
+    toIds(attribs, attributes);
+    for (unsigned int a = attributes.first(); a != Set::npos; a = attributes.next(a + 1)) {
+        mask[a / BITS] |= (word) 1 << (a % BITS);
+    }
+    lhsCount.reserve(table->size());
+    for (unsigned int i = 0; i < table->size(); ++i) {
+        const word *l = table->getLhs(i), *r = table->getRhs(i);
+        bool applied = false;
+        for (unsigned int w = 0; w < mask.size(); ++w) {
+            if (l[w] & ~mask[w]) {
+                applied = false;
+                break;
+            }
+            applied = applied || (r[w] & mask[w]);
+        }
+        lhsCount.push_back(table->getLhsSize(i) + (applied ? 0 : 1));
+        if (applied)
+            rules.push_back(i);
+    }
+    classify();
+}
+
+/**
+ *
+ * @details Only the applied rows are considered, as the other rows can not be
+ * applied within the attribute set. The attributes which are not on the rhs of
+ * any such row can not be derived, so they belong to every key. The attributes
+ * which are on the rhs but not on the lhs of any row can always be derived from
+ * the rest of a key, so they belong to no key. The rest of the attributes, 
+ * present on both sides, form the core of the search.
+ */
+template <class Set>
+void BasicAnalyzer<Set>::classify(void) {
+    Set left(dictionary.size()), right(dictionary.size());
+    for (unsigned int i : rules) {
+        left |= toSet(table->getLhs(i));
+        right |= toSet(table->getRhs(i));
+    }
+    mandatory = attributes;
+    mandatory -= right;
+    core = attributes;
+    core &= right;
+    core &= left;
+}
+
+/**
+ *
+ * @param row the lhs or the rhs row of a dependency of the table.
+ * @return The set of the identifiers of the row which are part of the attribute
+ * set.
+ */
+template <class Set>
+Set BasicAnalyzer<Set>::toSet(const word *row) const {
+    Set ret(dictionary.size());
+    for (unsigned int w = 0; w < mask.size(); ++w) {
+        for (word b = row[w] & mask[w]; b; b &= b - 1) {
+            ret.insert(w * BITS + __builtin_ctzll(b));
+        }
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param as the set of the attribute names.
+ * @param ret the identifier set where the identifiers of the names are inserted.
+ * @return true if all the names are present in the dictionary, false otherwise.
+ * The names which are not present in the dictionary are skipped.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::toIds(const set_str &as, Set &ret) const {
+    bool known = true;
+    unsigned int id;
+    for (const string &str : as) {
+        if (dictionary.find(str, id))
+            ret.insert(id);
+        else
+            known = false;
+    }
+    return known;
+}
+
+/**
+ *
+ * @param ids the set of the attribute identifiers.
+ * @return The set of the attribute names for the identifiers.
+ */
+template <class Set>
+set_str BasicAnalyzer<Set>::toNames(const Set &ids) const {
+    set_str ret;
+    for (unsigned int id = ids.first(); id != Set::npos; id = ids.next(id + 1)) {
+        ret.insert(ret.end(), dictionary.getName(id));
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param ids the set of the attribute identifiers.
+ * @return The vector of the identifiers in the increasing order.
+ */
+template <class Set>
+std::vector<unsigned int> BasicAnalyzer<Set>::toVector(const Set &ids) {
+    std::vector<unsigned int> ret;
+    for (unsigned int id = ids.first(); id != Set::npos; id = ids.next(id + 1)) {
+        ret.push_back(id);
+    }
+    return ret;
+}
+
+/**
+ *
+ * @return The number of attributes the attribute set type can hold, or zero
+ * for the AttrSet.
+ */
+template <class Set>
+unsigned int BasicAnalyzer<Set>::getWidth(void) const {
+    return getSetWidth((const Set *) 0);
+}
+
+/**
+ *
+ * @param lhs is the set of the identifiers on which closure operation is to be
+ * performed.
+ * @return the set of the identifiers which are result of the closure operation.
+ * @details Every row keeps the number of its lhs identifiers which are not yet
+ * present in the result. When an identifier is added to the result, the counter
+ * of every row in its posting list of the table is decremented, and the row 
+ * whose counter becomes zero adds its rhs to the result, restricted to the 
+ * attribute set. Every identifier is processed once and every row is applied 
+ * once, so the dependency set is not rescanned.
+ */
+template <class Set>
+Set BasicAnalyzer<Set>::calculateClosure(const Set &lhs) const {
+    Set ret(lhs);
+    std::vector<unsigned int> count(lhsCount);
+    std::vector<unsigned int> pending;
+    const FDTable &t = *table;
+    const word *m = mask.data();
+    unsigned int words = mask.size();
+    auto apply = [&](unsigned int i) {
+        const word *r = t.getRhs(i);
+        for (unsigned int w = 0; w < words; ++w) {
+            for (word b = r[w] & m[w]; b; b &= b - 1) {
+                unsigned int a = w * BITS + __builtin_ctzll(b);
+                if (ret.insert(a))
+                    pending.push_back(a);
+            }
+        }
+    };
+    for (unsigned int a = lhs.first(); a != Set::npos; a = lhs.next(a + 1)) {
+        pending.push_back(a);
+    }
+    for (unsigned int i : rules) {
+        if (!count[i])
+            apply(i);
+    }
+    while (!pending.empty()) {
+        unsigned int a = pending.back();
+        pending.pop_back();
+        for (unsigned int p = t.getOffset(a), e = t.getOffset(a + 1); p < e; ++p) {
+            unsigned int i = t.getPosting(p);
+            if (!--count[i])
+                apply(i);
+        }
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param lhs the set of the identifiers whose closure is searched.
+ * @param rhs the set of the identifiers to search for in the closure.
+ * @param count the buffer for the counters of the rules, reused by the
+ * subsequent calls so it is allocated only once.
+ * @return true if every identifier of rhs is in the closure of lhs, false
+ * otherwise.
+ * @details Same as BasicAnalyzer::calculateClosure, but the number of the rhs
+ * identifiers which are not yet derived is kept and the calculation stops when
+ * it becomes zero, so usually only few rows are applied. If the closure of lhs
+ * is already in the cache it is used instead. The closure is not complete when
+ * the calculation stops, so it is not added to the cache.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::derives(const Set &lhs, const Set &rhs,
+        std::vector<unsigned int> &count) const {
+    unsigned int missing = 0;
+    for (unsigned int a = rhs.first(); a != Set::npos; a = rhs.next(a + 1)) {
+        if (!lhs.contains(a))
+            ++missing;
+    }
+    if (!missing)
+        return true;
+    typename std::map<Set, Set>::const_iterator c = cache.find(lhs);
+    if (c != cache.end()) {
+        ++hits;
+        return isSubset(c->second, rhs);
+    }
+    Set ret(lhs);
+    count.assign(lhsCount.begin(), lhsCount.end());
+    std::vector<unsigned int> pending = toVector(lhs);
+    const FDTable &t = *table;
+    const word *m = mask.data();
+    unsigned int words = mask.size();
+    auto apply = [&](unsigned int i) -> bool {
+        const word *r = t.getRhs(i);
+        for (unsigned int w = 0; w < words; ++w) {
+            for (word b = r[w] & m[w]; b; b &= b - 1) {
+                unsigned int a = w * BITS + __builtin_ctzll(b);
+                if (!ret.insert(a))
+                    continue;
+                if (rhs.contains(a) && !--missing)
+                    return true;
+                pending.push_back(a);
+            }
+        }
+        return false;
+    };
+    for (unsigned int i : rules) {
+        if (!count[i] && apply(i))
+            return true;
+    }
+    while (!pending.empty()) {
+        unsigned int a = pending.back();
+        pending.pop_back();
+        for (unsigned int p = t.getOffset(a), e = t.getOffset(a + 1); p < e; ++p) {
+            unsigned int i = t.getPosting(p);
+            if (!--count[i] && apply(i))
+                return true;
+        }
+    }
+    return false;
+}
+
+/**
+ *
+ * @param lhs is the set of the identifiers on which closure operation is to be
+ * performed.
+ * @return the set of the identifiers which are result of the closure operation.
+ * @details The closure is calculated only if it is not found in the cache, and
+ * it is added to the cache while the cache has less than Analyzer::CACHE_SIZE
+ * entries.
+ */
+template <class Set>
+Set BasicAnalyzer<Set>::closure(const Set &lhs) const {
+    typename std::map<Set, Set>::const_iterator i = cache.find(lhs);
+    if (i != cache.end()) {
+        ++hits;
+        return i->second;
+    }
+    ++misses;
+    Set ret = calculateClosure(lhs);
+    if (cache.size() < CACHE_SIZE)
+        cache.insert(std::make_pair(lhs, ret));
+    return ret;
+}
+
+/**
+ *
+ * @param lhs is the set_str object that represents the set of attributes on
+ * which closure operation is to be performed.
+ * @return the set_str object containing all the attribute which are result of
+ * the closure operation.
+ * @details The attributes which are not known to the relation can not be derived
+ * by any dependency, so they are only copied to the result.
+ */
+template <class Set>
+set_str BasicAnalyzer<Set>::getClosure(const set_str &lhs) const {
+    Set ids(dictionary.size());
+    toIds(lhs, ids);
+    set_str ret = toNames(closure(ids));
+    ret.insert(lhs.begin(), lhs.end());
+    return ret;
+}
+
+/**
+ *
+ * @param lhs the lhs attributes of the dependency.
+ * @param rhs the rhs attributes of the dependency.
+ * @param count the buffer for the counters of the rules.
+ * @return true if the dependency is implied by the dependency set, false
+ * otherwise.
+ * @details The rhs attributes which are also in lhs are implied trivially, so
+ * the other rhs attributes which are not part of the dictionary can not be
+ * derived. The lhs attributes which are not part of the dictionary are not in
+ * the lhs of any rule, so they are skipped.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::implies(const set_str &lhs, const set_str &rhs,
+        std::vector<unsigned int> &count) const {
+    Set l(dictionary.size()), r(dictionary.size());
+    toIds(lhs, l);
+    unsigned int id;
+    for (const string &str : rhs) {
+        if (dictionary.find(str, id))
+            r.insert(id);
+        else if (!contains(lhs, str))
+            return false;
+    }
+    return derives(l, r, count);
+}
+
+/**
+ *
+ * @param lhs the lhs attributes of the dependency.
+ * @param rhs the rhs attributes of the dependency.
+ * @return true if every rhs attribute is in the closure of the lhs, false
+ * otherwise.
+ * @details The closure is calculated only until all the rhs attributes are
+ * derived.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::implies(const set_str &lhs, const set_str &rhs) const {
+    std::vector<unsigned int> count;
+    return implies(lhs, rhs, count);
+}
+
+/**
+ *
+ * @param deps the dependencies to test.
+ * @return vector of the results of the implication test for every dependency,
+ * in the order of the parameter.
+ * @details The buffer of the rule counters is shared by all the tests, so it
+ * is allocated only once for the batch.
+ */
+template <class Set>
+std::vector<bool> BasicAnalyzer<Set>::impliesAll(const std::vector<Dependency> &deps) const {
+    std::vector<bool> ret(deps.size());
+    std::vector<unsigned int> count;
+    count.reserve(lhsCount.size());
+    for (unsigned int i = 0; i < deps.size(); ++i) {
+        ret[i] = implies(deps[i].getLhs(), deps[i].getRhs(), count);
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param keys A set of existing working set in candidate key calculation.
+ * @param atribs The attribute set referred to calculate the next iteration of
+ * working set in candidate key calculation.
+ * @param ret The Level object where the next iteration of working set is
+ * stored, which may draw its nodes from another Arena than the parameter keys.
+ * @details The next iteration of working set will be constructed by adding one
+ * of the remaining attribute to find out all the possible combinations.
+ */
+template <class Set>
+void BasicAnalyzer<Set>::getNextIteration(const Level &keys, const Set &atribs,
+        Level &ret) {
+    for (const Set &k : keys) {
+        for (unsigned int a = atribs.first(); a != Set::npos; a = atribs.next(a + 1)) {
+            Set s = k;
+            if (s.insert(a))
+                ret.insert(s);
+        }
+    }
+}
+
+/**
+ *
+ * @return vector of the identifier sets of all the candidate keys.
+ * @details The search starts from the attributes which belong to every key and
+ * the working set is extended by one core attribute at every level. A set is
+ * accepted as key when its closure contains all the attributes and no smaller
+ * key is its subset, and the supersets of the accepted keys are not extended.
+ * The nodes of the working sets are drawn from two Arenas in turn: the next
+ * level is built in one while the current level is held by the other, which is
+ * then released, so the nodes of a level are reclaimed as soon as the next
+ * level is built.
+ */
+template <class Set>
+std::vector<Set> BasicAnalyzer<Set>::searchLevelwise(void) const {
+    std::vector<Set> ret;
+    if (attributes.empty())
+        return ret;
+    SetTrie<unsigned int> index;
+    Arena arenas[2];
+    Level levels[2] = {
+        Level(std::less<Set>(), ArenaAllocator<Set>(arenas[0])),
+        Level(std::less<Set>(), ArenaAllocator<Set>(arenas[1]))
+    };
+    unsigned int current = 0;
+    levels[current].insert(mandatory);
+    do {
+        Level &working = levels[current];
+        for (typename Level::iterator s = working.begin(); s != working.end();) {
+            std::vector<unsigned int> v = toVector(*s);
+            if (index.hasSubset(v.begin(), v.end())) {
+                working.erase(s++);
+            } else if (isSubset(closure(*s), attributes)) {
+                ret.push_back(*s);
+                index.insert(v.begin(), v.end());
+                working.erase(s++);
+            } else {
+                ++s;
+            }
+        }
+        getNextIteration(working, core, levels[1 - current]);
+        working.clear();
+        arenas[current].release();
+        current = 1 - current;
+    } while (!levels[current].empty());
+    return ret;
+}
+
+/**
+ *
+ * @return vector of the identifier sets of all the candidate keys.
+ * @details The search is same as the level wise search, but the closure of
+ * every candidate set of a level is calculated by the TaskScheduler shared by
+ * the process on all the hardware threads, and so is the extension of the sets
+ * into the next level. The keys are then accepted in the order of the sets, so
+ * the result is same as the result of BasicAnalyzer::searchLevelwise
+ * irrespective of the number of the threads. The closures are not cached, as the threads do not share the cache.
+ * The sets of the next level are merged by the calling thread in an Arena, which
+ * is released after every level.
+ */
+template <class Set>
+std::vector<Set> BasicAnalyzer<Set>::searchParallel(void) const {
+    std::vector<Set> ret;
+    if (attributes.empty())
+        return ret;
+    TaskScheduler &scheduler = TaskScheduler::getShared();
+    SetTrie<unsigned int> index;
+    Arena arena;
+    std::vector<Set> level(1, mandatory);
+    while (!level.empty()) {
+        std::vector<Set> candidates, rest;
+        for (const Set &s : level) {
+            std::vector<unsigned int> v = toVector(s);
+            if (!index.hasSubset(v.begin(), v.end()))
+                candidates.push_back(s);
+        }
+        std::vector<char> key(candidates.size());
+        scheduler.run(candidates.size(), [&](unsigned int i) {
+            key[i] = isSubset(calculateClosure(candidates[i]), attributes);
+        });
+        for (unsigned int i = 0; i < candidates.size(); ++i) {
+            if (key[i]) {
+                ret.push_back(candidates[i]);
+                std::vector<unsigned int> v = toVector(candidates[i]);
+                index.insert(v.begin(), v.end());
+            } else {
+                rest.push_back(candidates[i]);
+            }
+        }
+        std::vector<std::vector<Set> > next(rest.size());
+        scheduler.run(rest.size(), [&](unsigned int i) {
+            for (unsigned int a = core.first(); a != Set::npos; a = core.next(a + 1)) {
+                Set s = rest[i];
+                if (s.insert(a))
+                    next[i].push_back(s);
+            }
+        });
+        {
+            Level working{std::less<Set>(), ArenaAllocator<Set>(arena)};
+            for (const std::vector<Set> &n : next) {
+                working.insert(n.begin(), n.end());
+            }
+            level.assign(working.begin(), working.end());
+        }
+        arena.release();
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param budget the Budget of the search.
+ * @param ret the KeySearchResult object where the keys found are stored.
+ * @return true if all the keys within the size limit are found, false if the
+ * limit of the number of the keys is reached or the budget is exhausted.
+ * @details The search is same as BasicAnalyzer::searchLevelwise, which finds
+ * the keys in the order of their size, so it ends at the level of the size
+ * limit and the sets larger than the limit are never generated. Every set
+ * tested is charged to the budget before its closure is calculated. With the
+ * Relation::_PARALLEL algorithm the closures of the sets of a level which are
+ * within the budget are calculated by the shared TaskScheduler, otherwise they
+ * are taken from the cache. The keys which are not yet known are retained by the
+ * Analyzer, and if the search ends without the size limit all the keys are
+ * found.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::searchBounded(Budget &budget, KeySearchResult &ret) const {
+    const KeySearchOptions &options = budget.options;
+    unsigned int size = mandatory.size();
+    SetTrie<unsigned int> index;
+    Arena arena;
+    std::vector<Set> level;
+    if (!attributes.empty())
+        level.push_back(mandatory);
+    for (; !level.empty(); ++size) {
+        if (options.maxKeySize && size > options.maxKeySize)
+            return true;
+        std::vector<Set> candidates, rest;
+        for (const Set &s : level) {
+            std::vector<unsigned int> v = toVector(s);
+            if (index.hasSubset(v.begin(), v.end()))
+                continue;
+            if (!budget.spend())
+                break;
+            candidates.push_back(s);
+        }
+        std::vector<char> key(candidates.size());
+        if (engine == Relation::_PARALLEL) {
+            TaskScheduler::getShared().run(candidates.size(), [&](unsigned int i) {
+                key[i] = isSubset(calculateClosure(candidates[i]), attributes);
+            });
+        } else {
+            for (unsigned int i = 0; i < candidates.size(); ++i) {
+                key[i] = isSubset(closure(candidates[i]), attributes);
+            }
+        }
+        for (unsigned int i = 0; i < candidates.size(); ++i) {
+            if (!key[i]) {
+                rest.push_back(candidates[i]);
+                continue;
+            }
+            if (options.maxKeys && ret.keys.size() >= options.maxKeys)
+                return false;
+            std::vector<unsigned int> v = toVector(candidates[i]);
+            index.insert(v.begin(), v.end());
+            if (!keyIndex.hasSubset(v.begin(), v.end()))
+                addKey(candidates[i]);
+            ret.keys.insert(toNames(candidates[i]));
+        }
+        if (budget.exhausted)
+            return false;
+        {
+            Level working{std::less<Set>(), ArenaAllocator<Set>(arena)};
+            Level next{std::less<Set>(), ArenaAllocator<Set>(arena)};
+            working.insert(rest.begin(), rest.end());
+            getNextIteration(working, core, next);
+            level.assign(next.begin(), next.end());
+        }
+        arena.release();
+    }
+    searched = true;
+    return true;
+}
+
+/**
+ *
+ * @param key the identifier set of a super-key of the relation.
+ * @param keep the identifier which is not removed, default value is Set::npos
+ * in which case every attribute can be removed.
+ * @param budget the pointer of the Budget of the search, default value is null
+ * in which case the minimization is not limited.
+ * @return The identifier set of a candidate key which is subset of the
+ * parameter, or with the keep identifier a super-key which has no proper subset
+ * containing the identifier that is a super-key. If the budget is exhausted the
+ * super-key is returned before it is minimized, and the budget is marked as
+ * exhausted.
+ * @details Every core attribute of the parameter is removed in turn if the
+ * rest of the attributes are still a super-key, so the result has no proper
+ * subset which is a super-key. The other attributes of the parameter belong to
+ * every key, so they are not tested. Every closure taken is charged to the
+ * budget.
+ */
+template <class Set>
+Set BasicAnalyzer<Set>::minimize(Set key, unsigned int keep, Budget *budget) const {
+    Set all = key;
+    all &= core;
+    for (unsigned int a = all.first(); a != Set::npos; a = all.next(a + 1)) {
+        if (a == keep)
+            continue;
+        if (budget && !budget->spend())
+            return key;
+        key.erase(a);
+        if (!isSubset(closure(key), attributes))
+            key.insert(a);
+    }
+    return key;
+}
+
+/**
+ *
+ * @return vector of the identifier sets of all the candidate keys.
+ * @details The level wise search of the Relation::_PARALLEL algorithm is used
+ * if it is selected for the relation, otherwise the sequential one.
+ */
+template <class Set>
+std::vector<Set> BasicAnalyzer<Set>::searchKeys(void) const {
+    if (engine == Relation::_PARALLEL)
+        return searchParallel();
+    return searchLevelwise();
+}
+
+/**
+ *
+ * @param key the identifier set of a new candidate key.
+ * @details The key is added to the keys, to the index of the keys and to the
+ * prime attributes.
+ */
+template <class Set>
+void BasicAnalyzer<Set>::addKey(const Set &key) const {
+    keys.push_back(key);
+    primes |= key;
+    std::vector<unsigned int> v = toVector(key);
+    keyIndex.insert(v.begin(), v.end());
+}
+
+/**
+ *
+ * @return true if at least one new key is found, false if all the keys are
+ * already found.
+ * @details For the Relation::_LUCCHESI_OSBORN algorithm a single key is found
+ * by every call. The other algorithms find all the remaining keys at the first
+ * call, skipping the keys which are already found.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::findNext(void) const {
+    if (searched)
+        return false;
+    if (engine == Relation::_LUCCHESI_OSBORN)
+        return step(0);
+    unsigned int count = keys.size();
+    for (const Set &k : searchKeys()) {
+        std::vector<unsigned int> v = toVector(k);
+        if (!keyIndex.hasSubset(v.begin(), v.end()))
+            addKey(k);
+    }
+    searched = true;
+    return keys.size() > count;
+}
+
+/**
+ *
+ * @param budget the pointer of the Budget of the search, or null if the search
+ * is not limited.
+ * @return true if a new key is found, false if all the keys are already found
+ * or the budget is exhausted.
+ * @details The step of the Lucchesi-Osborn algorithm. The first key is found by
+ * minimizing the attribute set without the attributes which belong to no key.
+ * For every key K and every rule X -> Y the set X U (K - Y) is a super-key, and
+ * if it is not superset of any known key it is minimized into the next key.
+ * The position of the key and the rule is kept between the calls, so every
+ * pair is processed once and the time of the search is polynomial in the
+ * number of the keys, the attributes and the rules. Only the applied rows of
+ * the table are used as the rules. Every examined pair and every closure of
+ * the minimization is charged to the budget, and a pair whose minimization is
+ * interrupted by the budget is processed again by the next call.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::step(Budget *budget) const {
+    if (keys.empty()) {
+        if (attributes.empty()) {
+            searched = true;
+            return false;
+        }
+        if (budget && !budget->spend())
+            return false;
+        Set all = mandatory;
+        all |= core;
+        Set key = minimize(all, Set::npos, budget);
+        if (budget && budget->exhausted)
+            return false;
+        addKey(key);
+        return true;
+    }
+    for (; nextKey < keys.size(); ++nextKey, nextRule = 0) {
+        while (nextRule < rules.size()) {
+            if (budget && !budget->spend())
+                return false;
+            unsigned int r = rules[nextRule++];
+            Set s = keys[nextKey];
+            s -= toSet(table->getRhs(r));
+            s |= toSet(table->getLhs(r));
+            std::vector<unsigned int> v = toVector(s);
+            if (!keyIndex.hasSubset(v.begin(), v.end())) {
+                Set key = minimize(s, Set::npos, budget);
+                if (budget && budget->exhausted) {
+                    --nextRule;
+                    return false;
+                }
+                addKey(key);
+                return true;
+            }
+        }
+    }
+    searched = true;
+    return false;
+}
+
+/**
+ *
+ * @param options the limits of the search.
+ * @return KeySearchResult object containing the keys found within the limits,
+ * and whether all the keys within the limits of the size and the number of the
+ * keys are found.
+ * @details If all the keys are not yet found and either the level wise
+ * algorithms are selected or the key size is limited, the keys are searched by
+ * BasicAnalyzer::searchBounded. The Lucchesi-Osborn algorithm derives the
+ * smaller keys from the larger ones, so it can not skip the sets larger than
+ * the size limit, and the level wise search is used for the limited size
+ * whatever algorithm is selected. Otherwise the keys already found by the
+ * Analyzer are reported first, and the search is continued by the steps of the
+ * Lucchesi-Osborn algorithm, which finds the keys one at a time, until the
+ * limit of the number of the keys is reached, the time or the node budget is
+ * exhausted or all the keys are found. The keys found are retained by the
+ * Analyzer for the following calls.
+ */
+template <class Set>
+KeySearchResult BasicAnalyzer<Set>::getCandidatekey(const KeySearchOptions &options) const {
+    KeySearchResult ret;
+    Budget budget(options);
+    if (!searched && (engine != Relation::_LUCCHESI_OSBORN || options.maxKeySize)) {
+        ret.complete = searchBounded(budget, ret);
+        return ret;
+    }
+    unsigned int i = 0;
+    while (!options.maxKeys || ret.keys.size() < options.maxKeys) {
+        if (i == keys.size() && (searched || !step(&budget)))
+            break;
+        if (!options.maxKeySize || keys[i].size() <= options.maxKeySize)
+            ret.keys.insert(toNames(keys[i]));
+        ++i;
+    }
+    ret.complete = searched && i == keys.size();
+    return ret;
+}
+
+/**
+ *
+ * @return The constant reference of the vector of the identifier sets of all
+ * the candidate keys.
+ * @details The remaining keys are searched on the first call, and the
+ * following calls return the same keys.
+ */
+template <class Set>
+const std::vector<Set>& BasicAnalyzer<Set>::getKeys(void) const {
+    while (findNext());
+    return keys;
+}
+
+/**
+ *
+ * @return set_str object containing the attributes of a candidate key, or the
+ * empty set if the relation have no attributes.
+ * @details The key is found by minimizing the attributes which belong to every
+ * key together with the core attributes, which takes a closure for every core
+ * attribute, so the time is polynomial even if the relation have a large number
+ * of the keys. It is same as the first key found by the
+ * Relation::_LUCCHESI_OSBORN algorithm.
+ */
+template <class Set>
+set_str BasicAnalyzer<Set>::getAnyCandidateKey(void) const {
+    if (attributes.empty())
+        return set_str();
+    Set all = mandatory;
+    all |= core;
+    return toNames(minimize(all));
+}
+
+/**
+ *
+ * @param i the position of the key in the order the keys are found.
+ * @param key the set_str object where the attribute names of the key are stored.
+ * @return true if the key is found, false if the relation have less keys.
+ * @details The keys are searched only until the key at the position is found.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::getKey(unsigned int i, set_str &key) const {
+    while (i >= keys.size() && findNext());
+    if (i >= keys.size())
+        return false;
+    key = toNames(keys[i]);
+    return true;
+}
+
+/**
+ *
+ * @return set of keys object containing all the possible candidate keys for the
+ * relation.
+ */
+template <class Set>
+set_key BasicAnalyzer<Set>::getCandidatekey(void) const {
+    set_key ret;
+    for (const Set &k : getKeys()) {
+        ret.insert(toNames(k));
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param lhs represents the attribute set to find out is supekey or not.
+ * @return true if the closure of the parameter lhs contains all the attributes,
+ * false otherwise.
+ * @details The attribute set is a super-key if and only if it is superset of a
+ * candidate key, which is same as its closure contains all the attributes, so
+ * the keys are not searched. The attributes which are not part of the relation
+ * are not considered.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::isSuperkey(const set_str &lhs) const {
+    Set ids(dictionary.size());
+    toIds(lhs, ids);
+    ids &= attributes;
+    return isSubset(closure(ids), attributes);
+}
+
+/**
+ *
+ * @param lhs represents the attribute sets to find out are supekey or not.
+ * @return vector of the results of the super-key test for every attribute set,
+ * in the order of the parameter.
+ * @details The attribute sets are tested in the increasing order of their size
+ * and the super-keys are added to an index, so an attribute set which is
+ * superset of an already found super-key is accepted without the closure.
+ */
+template <class Set>
+std::vector<bool> BasicAnalyzer<Set>::isSuperkey(const std::vector<set_str> &lhs) const {
+    std::vector<bool> ret(lhs.size());
+    std::vector<unsigned int> order(lhs.size());
+    for (unsigned int i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) {
+        return lhs[a].size() < lhs[b].size();
+    });
+    SetTrie<unsigned int> index;
+    for (unsigned int i : order) {
+        Set ids(dictionary.size());
+        toIds(lhs[i], ids);
+        ids &= attributes;
+        std::vector<unsigned int> v = toVector(ids);
+        if (index.hasSubset(v.begin(), v.end())) {
+            ret[i] = true;
+        } else if (isSubset(closure(ids), attributes)) {
+            ret[i] = true;
+            index.insert(v.begin(), v.end());
+        }
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param lhs represents the attribute set which is to find out is partial key or not.
+ * @return true if the parameter lhs is subset of at least one candidate key and
+ * it is not the super-key, false otherwise.
+ * @details The parameter is a super-key if its closure contains all the
+ * attributes, so only the first condition requires the keys, and they are
+ * searched only until a key which is superset of the parameter is found.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::isPartialkey(const set_str &lhs) const {
+    Set ids(dictionary.size());
+    if (!toIds(lhs, ids) || !isSubset(attributes, ids) || isSuperkey(lhs))
+        return false;
+    std::vector<unsigned int> v = toVector(ids);
+    while (!keyIndex.hasSuperset(v.begin(), v.end()) && findNext());
+    return keyIndex.hasSuperset(v.begin(), v.end());
+}
+
+/**
+ *
+ * @param a the identifier of the attribute.
+ * @return true if the attribute belongs to at least one candidate key, false
+ * otherwise.
+ * @details The attributes which belong to every key are prime, and the
+ * attributes which are not core belong to no key, so only the core attributes
+ * are searched. For a core attribute a super-key containing it is minimized
+ * without removing the attribute, and if the attribute can not be removed from
+ * the result either, the result is a key containing the attribute. The
+ * attribute set and the sets X U (K - Y) for every known key K and every rule
+ * X -> Y with the attribute in X, found by the posting list of the attribute
+ * and skipping the rows which are not applied, are tried, and only if none of them is a
+ * witness the keys are searched until a key containing the attribute is found
+ * or all the keys are found. Every key found is retained, so its attributes
+ * are known to be prime for the following calls.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::isPrimeAttribute(unsigned int a) const {
+    if (primes.contains(a) || mandatory.contains(a))
+        return true;
+    if (!core.contains(a) || searched)
+        return false;
+    std::vector<Set> seeds(1, mandatory);
+    seeds[0] |= core;
+    for (unsigned int i = 0; i < keys.size(); ++i) {
+        for (unsigned int p = table->getOffset(a); p < table->getOffset(a + 1); ++p) {
+            unsigned int r = table->getPosting(p);
+            if (lhsCount[r] != table->getLhsSize(r))
+                continue;
+            Set s = keys[i];
+            s -= toSet(table->getRhs(r));
+            s |= toSet(table->getLhs(r));
+            seeds.push_back(s);
+        }
+    }
+    for (const Set &s : seeds) {
+        Set key = minimize(s, a);
+        Set rest = key;
+        rest.erase(a);
+        if (!isSubset(closure(rest), attributes)) {
+            addKey(key);
+            return true;
+        }
+    }
+    while (!primes.contains(a) && findNext());
+    return primes.contains(a);
+}
+
+/**
+ *
+ * @param str represents the attribute set which is to find out is prime or not.
+ * @return true if every attribute of the parameter str is a prime attribute,
+ * false otherwise.
+ * @details An attribute is prime if it is present in at least one candidate
+ * key, so the attributes of the parameter need not to belong to the same key.
+ * Every attribute is decided by BasicAnalyzer::isPrimeAttribute, and the test
+ * stops at the first attribute which is not prime.
+ */
+template <class Set>
+bool BasicAnalyzer<Set>::isPrime(const set_str &str) const {
+    Set ids(dictionary.size());
+    if (!toIds(str, ids))
+        return false;
+    for (unsigned int a = ids.first(); a != Set::npos; a = ids.next(a + 1)) {
+        if (!isPrimeAttribute(a))
+            return false;
+    }
+    return true;
+}
+
+/**
+ *
+ * @return set_str object containing the attributes which belong to at least one
+ * candidate key.
+ * @details Every attribute is decided by BasicAnalyzer::isPrimeAttribute, and
+ * the keys found for an attribute are shared with the following attributes, so
+ * the attributes of a found key are not searched again.
+ */
+template <class Set>
+set_str BasicAnalyzer<Set>::getPrimeAttributes(void) const {
+    Set ret(dictionary.size());
+    for (unsigned int a = attributes.first(); a != Set::npos; a = attributes.next(a + 1)) {
+        if (isPrimeAttribute(a))
+            ret.insert(a);
+    }
+    return toNames(ret);
+}
+
+#endif /* BASIC_ANALYZER_DEF_H */
@@ -0,0 +1,233 @@
+/*! \file cover_engine.cc
+ *
+ * \brief Includes definitions of the CoverEngine class members defined in the
+ * cover_engine.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * CoverEngine.
+ *
+ */
+#include "cover_engine.h"
+#include "dependency.h"
+
+#include <algorithm>
+#include <map>
+
+/*!
+  \def BITS
+  Defines the number of bits in a word of the rows.
+ */
+#define BITS (8 * sizeof (AttrKernel::word))
+
+/**
+ *
+ * @param deps the dependency set whose minimal cover is to be calculated.
+ * @details Every dependency is split into the dependencies with a single rhs
+ * attribute, and the rules are stored in the order of the split dependency set,
+ * so the duplicates are removed. The attribute names are interned in their
+ * order, so the lhs identifiers are processed in the order of the names. The
+ * lists of the rules are counted first and filled in the second pass.
+ */
+CoverEngine::CoverEngine(const set_dep &deps) {
+    set_dep split;
+    set_str names;
+    for (const Dependency &d : deps) {
+        const set_str &l = d.getLhs(), &r = d.getRhs();
+        names.insert(l.begin(), l.end());
+        names.insert(r.begin(), r.end());
+        for (const string &a : r) {
+            split.insert(Dependency(l, {a}));
+        }
+    }
+    dictionary.intern(names);
+    words = (dictionary.size() + BITS - 1) / BITS;
+    lhs.assign(split.size() * words, 0);
+    offsets.assign(dictionary.size() + 1, 0);
+    unsigned int id, i = 0;
+    for (const Dependency &d : split) {
+        word *row = getLhs(i++);
+        for (const string &a : d.getLhs()) {
+            dictionary.find(a, id);
+            row[id / BITS] |= (word) 1 << (id % BITS);
+            ++offsets[id + 1];
+        }
+        dictionary.find(*d.getRhs().begin(), id);
+        rhs.push_back(id);
+        lhsCount.push_back(d.getLhs().size());
+        active.push_back(true);
+    }
+    for (unsigned int a = 0; a < dictionary.size(); ++a) {
+        offsets[a + 1] += offsets[a];
+    }
+    postings.resize(offsets.back());
+    std::vector<unsigned int> next(offsets.begin(), offsets.end() - 1);
+    for (i = 0; i < rhs.size(); ++i) {
+        const word *row = getLhs(i);
+        for (unsigned int w = 0; w < words; ++w) {
+            for (word b = row[w]; b; b &= b - 1) {
+                postings[next[w * BITS + __builtin_ctzll(b)]++] = i;
+            }
+        }
+    }
+    closure.resize(words);
+    pending.reserve(dictionary.size());
+}
+
+/**
+ *
+ * @param x the row of bits of the identifier set whose closure is searched.
+ * @param target the identifier to search for in the closure.
+ * @param skip the index of the rule which is not used, or a value out of the
+ * range of the rules to use all the rules.
+ * @return true if the target is in the closure of x under the active rules,
+ * false otherwise.
+ * @details The LINCLOSURE algorithm, a rule is applied when all its lhs
+ * identifiers are derived, so every rule is examined once for every lhs
+ * identifier. The search stops as soon as the target is derived. The postings
+ * are not updated when an identifier is removed from a lhs, so the identifiers
+ * which are no longer in the lhs of the rule are skipped.
+ */
+bool CoverEngine::implies(const word *x, unsigned int target,
+        unsigned int skip) const {
+    if (x[target / BITS] >> (target % BITS) & 1)
+        return true;
+    count = lhsCount;
+    pending.clear();
+    std::copy(x, x + words, closure.begin());
+    for (unsigned int w = 0; w < words; ++w) {
+        for (word b = x[w]; b; b &= b - 1) {
+            pending.push_back(w * BITS + __builtin_ctzll(b));
+        }
+    }
+    for (unsigned int i = 0; i < rhs.size(); ++i) {
+        if (!count[i] && active[i] && i != skip && derive(rhs[i])) {
+            if (rhs[i] == target)
+                return true;
+        }
+    }
+    while (!pending.empty()) {
+        unsigned int a = pending.back();
+        pending.pop_back();
+        for (unsigned int p = offsets[a]; p < offsets[a + 1]; ++p) {
+            unsigned int i = postings[p];
+            if (!active[i] || i == skip
+                    || !(getLhs(i)[a / BITS] >> (a % BITS) & 1) || --count[i])
+                continue;
+            if (derive(rhs[i]) && rhs[i] == target)
+                return true;
+        }
+    }
+    return false;
+}
+
+/**
+ *
+ * @param a the identifier derived by a rule.
+ * @return true if the identifier is new to the closure, false otherwise.
+ * @details A new identifier is added to the closure and to the pending ones.
+ */
+bool CoverEngine::derive(unsigned int a) const {
+    word bit = (word) 1 << (a % BITS);
+    if (closure[a / BITS] & bit)
+        return false;
+    closure[a / BITS] |= bit;
+    pending.push_back(a);
+    return true;
+}
+
+/**
+ *
+ * @return true if at least one attribute is removed, false otherwise.
+ * @details A lhs attribute is extraneous if the rhs of the rule is in the
+ * closure of the rest of the lhs. The attributes of every lhs are tested once
+ * in their order, as the dependency set stays equivalent after the removal and
+ * an attribute which is not extraneous remains so for the smaller lhs. The 
+ * rest of the lhs is tested in a separate row, as the rule itself takes part 
+ * in the test with its current lhs.
+ */
+bool CoverEngine::reduceLHS(void) {
+    bool change = false;
+    std::vector<word> all(words), rest(words);
+    for (unsigned int i = 0; i < rhs.size(); ++i) {
+        if (!active[i] || lhsCount[i] < 2)
+            continue;
+        word *row = getLhs(i);
+        std::copy(row, row + words, all.begin());
+        for (unsigned int w = 0; w < words; ++w) {
+            for (word b = all[w]; b && lhsCount[i] > 1; b &= b - 1) {
+                std::copy(row, row + words, rest.begin());
+                rest[w] &= ~(b & -b);
+                if (implies(rest.data(), rhs[i], rhs.size())) {
+                    row[w] &= ~(b & -b);
+                    --lhsCount[i];
+                    change = true;
+                }
+            }
+        }
+    }
+    return change;
+}
+
+/**
+ *
+ * @return true if at least one rule is removed, false otherwise.
+ * @details A rule is redundant if its rhs is in the closure of its lhs under
+ * the other active rules. The rules are tested in their order, and a redundant
+ * rule is removed before the next rule is tested, so of two equal rules only
+ * the first is removed.
+ */
+bool CoverEngine::reduceRules(void) {
+    bool change = false;
+    for (unsigned int i = 0; i < rhs.size(); ++i) {
+        if (active[i] && implies(getLhs(i), rhs[i], i)) {
+            active[i] = false;
+            change = true;
+        }
+    }
+    return change;
+}
+
+/**
+ *
+ * @param merge a boolean parameter with default value false. If true the rules
+ * with the same lhs are combined into a single dependency.
+ * @return The set of the dependencies of the active rules.
+ */
+set_dep CoverEngine::getDependencies(bool merge) const {
+    set_dep ret;
+    if (!merge) {
+        for (unsigned int i = 0; i < rhs.size(); ++i) {
+            if (active[i])
+                ret.insert(Dependency(toNames(getLhs(i)), {dictionary.getName(rhs[i])}));
+        }
+        return ret;
+    }
+    std::map<std::vector<word>, set_str> rules;
+    for (unsigned int i = 0; i < rhs.size(); ++i) {
+        if (active[i])
+            rules[std::vector<word>(getLhs(i), getLhs(i) + words)].insert(
+                dictionary.getName(rhs[i]));
+    }
+    for (const auto &r : rules) {
+        ret.insert(Dependency(toNames(r.first.data()), r.second));
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param row the row of bits of the identifiers.
+ * @return set_str object containing the attribute names of the identifiers.
+ */
+set_str CoverEngine::toNames(const word *row) const {
+    set_str ret;
+    for (unsigned int w = 0; w < words; ++w) {
+        for (word b = row[w]; b; b &= b - 1) {
+            ret.insert(dictionary.getName(w * BITS + __builtin_ctzll(b)));
+        }
+    }
+    return ret;
+}
+
+#undef BITS
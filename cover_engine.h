@@ -0,0 +1,122 @@
+/*! \file cover_engine.h
+ *
+ * \brief Includes declaration for the class CoverEngine and its members.
+ *
+ * \details
+ * This file declares the definition of the class CoverEngine along with its
+ * subsequent data members and the member functions prototype.
+ *
+ */
+#ifndef COVER_ENGINE_H
+#define COVER_ENGINE_H
+
+#include "declaration.h"
+#include "attribute_dictionary.h"
+#include "attr_kernel.h"
+
+#include <vector>
+
+/*!
+ * \class CoverEngine
+ * \brief The CoverEngine class calculates the minimal cover of a dependency
+ * set on a flat array of the dependencies in the identifier form.
+ * \details The dependencies are split into the rules with a single rhs
+ * attribute when the engine is constructed, so the reduced RHS form is the
+ * initial state. The lhs reduction and the removal of the redundant rules then
+ * modify the array in place, the removed rules are only marked as inactive.
+ * Both the steps are decided by the membership test of an attribute in the
+ * closure, which is calculated by the LINCLOSURE algorithm using the number of
+ * lhs attributes of every rule and the list of the rules for every attribute,
+ * and which stops as soon as the attribute is derived. So no dependency set is
+ * copied and no attribute name is compared until the result is returned. The
+ * lhs of all the rules are stored as the rows of bits one after another in a
+ * single array, and the lists of the rules of all the attributes in another one
+ * in the compressed sparse row form, as in the BasicAnalyzer. The buffers of 
+ * the closure are allocated once and reused by every test.
+ */
+class CoverEngine {
+public:
+
+    /**
+     * @brief Constructs the reduced RHS form of the dependency set.
+     */
+    explicit CoverEngine(const set_dep &);
+
+    /**
+     * @brief A method to remove the extraneous attributes from the lhs of
+     * every rule.
+     */
+    bool reduceLHS(void);
+
+    /**
+     * @brief A method to remove the rules which are implied by the other
+     * rules.
+     */
+    bool reduceRules(void);
+
+    /**
+     * @brief A method to get the current rules as the dependency set.
+     */
+    set_dep getDependencies(bool merge = false) const;
+
+private:
+    typedef AttrKernel::word word; /*!< The type of a single word of bits*/
+
+    AttributeDictionary dictionary; /*!< The identifiers of the attributes*/
+    unsigned int words; /*!< The number of the words of every lhs row*/
+    std::vector<word> lhs; /*!< The lhs rows of all the rules*/
+    std::vector<unsigned int> rhs; /*!< The rhs identifier of every rule*/
+    std::vector<unsigned int> lhsCount; /*!< The number of lhs identifiers of
+                                         * every rule*/
+    std::vector<bool> active; /*!< Indicates whether the rule is not removed*/
+    std::vector<unsigned int> offsets; /*!< The offset of the list of the rules
+                                        * of every identifier, followed by the
+                                        * total number of the postings*/
+    std::vector<unsigned int> postings; /*!< The indices of the rules whose lhs
+                                         * contains the identifier, of all the
+                                         * identifiers*/
+    mutable std::vector<word> closure; /*!< The closure of the current test*/
+    mutable std::vector<unsigned int> count; /*!< The number of the lhs 
+                                              * identifiers of every rule not 
+                                              * yet derived in the current test*/
+    mutable std::vector<unsigned int> pending; /*!< The derived identifiers not
+                                                * yet processed in the current
+                                                * test*/
+
+    /**
+     * @brief A method to get the lhs row of the rule.
+     * @param i the index of the rule.
+     * @return The pointer to the first word of the row.
+     */
+    word* getLhs(unsigned int i) {
+        return lhs.data() + i * words;
+    }
+
+    /**
+     * @brief A method to get the lhs row of the rule.
+     * @param i the index of the rule.
+     * @return The pointer to the first word of the row.
+     */
+    const word* getLhs(unsigned int i) const {
+        return lhs.data() + i * words;
+    }
+
+    /**
+     * @brief A method to test whether the attribute is in the closure of the
+     * identifier set.
+     */
+    bool implies(const word *, unsigned int, unsigned int) const;
+
+    /**
+     * @brief A method to add the derived identifier to the closure of the 
+     * current test.
+     */
+    bool derive(unsigned int) const;
+
+    /**
+     * @brief Converts the row of bits into the attribute names.
+     */
+    set_str toNames(const word *) const;
+};
+
+#endif /* COVER_ENGINE_H */
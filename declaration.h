@@ -44,6 +44,28 @@ public:
     bool operator()(const set_str &lhs, const set_str &rhs) const;
 };
 
+/*! \class setstr_hash
+ *  \brief The function object class for calculating the hash value of the set
+ *  of string, so it can be used as the key of the unordered containers.
+ */
+class setstr_hash {
+public:
+
+    /**
+     * @breif Calculates the hash value of the set_str object.
+     * @param str Argument whose hash value is calculated.
+     * @return The hash value combined from the hash values of all the strings.
+     */
+    static std::size_t hash(const set_str &str);
+
+    /**
+     * @breif The overloaded operator () to use the function object as a hash.
+     * @param str Argument whose hash value is calculated.
+     * @return The result from member function hash.
+     */
+    std::size_t operator()(const set_str &str) const;
+};
+
 /*! \var typedef set<set_str, setstr_compare> set_key
     \brief A type definition for a set of set of string with set_str with the 
     custom compare class setstr_compare.
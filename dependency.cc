@@ -12,6 +12,7 @@
 #include "utility.h"
 #include <iostream>
 #include <algorithm>
+#include <utility>
 
 /**
  * 
@@ -36,6 +37,43 @@ Dependency::Dependency(const Dependency& orig) :
 lhs(orig.lhs), rhs(orig.rhs) {
 }
 
+/**
+ * 
+ * @param orig is the Dependency object whose attribute sets are moved to the 
+ * newly constructed object.
+ * @details The nodes of the lhs and rhs sets are taken over without copying the
+ * strings, and the parameter is left with the empty sets.
+ */
+Dependency::Dependency(Dependency&& orig) :
+lhs(std::move(orig.lhs)), rhs(std::move(orig.rhs)) {
+}
+
+/**
+ * 
+ * @param right is the Dependency object which to be copied.
+ * @return The reference of the current dependency object.
+ */
+Dependency& Dependency::operator=(const Dependency& right) {
+    if (this != &right) {
+        lhs = right.lhs;
+        rhs = right.rhs;
+    }
+    return *this;
+}
+
+/**
+ * 
+ * @param right is the Dependency object whose attribute sets are moved.
+ * @return The reference of the current dependency object.
+ */
+Dependency& Dependency::operator=(Dependency&& right) {
+    if (this != &right) {
+        lhs = std::move(right.lhs);
+        rhs = std::move(right.rhs);
+    }
+    return *this;
+}
+
 /**
  * 
  * @details The destructor clears the string objects from the both lhs and rhs 
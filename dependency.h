@@ -35,8 +35,12 @@ using std::ostream;
  */
 class Dependency {
     friend class Relation;
+    friend class CoverEngine;
     friend class dependency_test;
     friend class relation_test;
+    friend class cover_engine_test;
+    friend class dependency_index_test;
+    friend class fd_table_test;
 
     friend ostream& operator<<(ostream &, const Dependency &);
 
@@ -51,6 +55,21 @@ public:
      */
     Dependency(const Dependency& orig);
 
+    /**
+     * @breif The move constructor of the Dependency class.
+     */
+    Dependency(Dependency&& orig);
+
+    /**
+     * @breif The copy assignment operator of the Dependency class.
+     */
+    Dependency& operator=(const Dependency& right);
+
+    /**
+     * @breif The move assignment operator of the Dependency class.
+     */
+    Dependency& operator=(Dependency&& right);
+
     /**
      * @breif The overloaded less operator for testing inequality the dependency 
      * objects.
@@ -59,15 +78,19 @@ public:
 
     /**
      * @breif The getter method for retrieve the left-hand side attribute set.
+     * @return The constant reference of the lhs set, valid as long as the 
+     * dependency object.
      */
-    set_str getLhs() const {
+    const set_str& getLhs() const {
         return lhs;
     }
 
     /**
      * @breif The getter method for retrieve the right-hand side attribute set.
+     * @return The constant reference of the rhs set, valid as long as the 
+     * dependency object.
      */
-    set_str getRhs() const {
+    const set_str& getRhs() const {
         return rhs;
     }
 
@@ -0,0 +1,192 @@
+/*! \file dependency_index.cc
+ *
+ * \brief Includes definitions of the DependencyIndex class members defined in
+ * the dependency_index.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * DependencyIndex.
+ *
+ */
+#include "dependency_index.h"
+#include "dependency.h"
+
+#include <algorithm>
+
+DependencyIndex::DependencyIndex() : base(0), live(0), changes(0), built(false) {
+}
+
+/**
+ *
+ * @param deps the dependency set to be indexed.
+ * @details Every attribute is posted once for every dependency, even if it is
+ * present on both the sides of the dependency. The dictionary of the attributes
+ * is started again, so it contains only the attributes of the dependency set.
+ */
+void DependencyIndex::build(const set_dep &deps) {
+    clear();
+    dictionary = AttributeDictionary();
+    std::vector<unsigned int> ids, sizes;
+    for (itr_dep i = deps.begin(); i != deps.end(); ++i) {
+        set_str as = i->getAttribs();
+        slots[&*i] = positions.size();
+        positions.push_back(i);
+        sizes.push_back(as.size());
+        for (const string &str : as) {
+            ids.push_back(dictionary.intern(str));
+        }
+    }
+    offsets.assign(dictionary.size() + 1, 0);
+    for (unsigned int id : ids) {
+        ++offsets[id + 1];
+    }
+    for (unsigned int a = 0; a < dictionary.size(); ++a) {
+        offsets[a + 1] += offsets[a];
+    }
+    postings.resize(ids.size());
+    std::vector<unsigned int> next(offsets.begin(), offsets.end() - 1);
+    unsigned int k = 0;
+    for (unsigned int d = 0; d < positions.size(); ++d) {
+        for (unsigned int n = sizes[d]; n; --n) {
+            postings[next[ids[k++]]++] = d;
+        }
+    }
+    removed.assign(positions.size(), false);
+    base = live = positions.size();
+    built = true;
+}
+
+/**
+ * @details The storage of the arrays is retained for the next build.
+ */
+void DependencyIndex::clear(void) {
+    positions.clear();
+    removed.clear();
+    added.clear();
+    slots.clear();
+    base = live = changes = 0;
+    built = false;
+}
+
+/**
+ *
+ * @param i the position of the dependency inserted into the indexed set.
+ * @details The dependency is given the next index, and the index is posted in
+ * the list of the added dependencies of every of its attributes. Nothing is 
+ * done if the index is not built.
+ */
+void DependencyIndex::insert(itr_dep i) {
+    if (!built || slots.count(&*i))
+        return;
+    unsigned int d = positions.size();
+    slots[&*i] = d;
+    positions.push_back(i);
+    removed.push_back(false);
+    for (const string &str : i->getAttribs()) {
+        unsigned int id = dictionary.intern(str);
+        if (added.size() <= id)
+            added.resize(id + 1);
+        added[id].push_back(d);
+    }
+    ++live;
+    ++changes;
+}
+
+/**
+ *
+ * @param i the position of the dependency to be erased from the indexed set.
+ * @details The dependency is only marked as removed, its postings are skipped
+ * by the searches until the next build. Nothing is done if the index is not 
+ * built.
+ */
+void DependencyIndex::erase(itr_dep i) {
+    if (!built)
+        return;
+    auto s = slots.find(&*i);
+    if (s == slots.end())
+        return;
+    removed[s->second] = true;
+    slots.erase(s);
+    --live;
+    ++changes;
+}
+
+/**
+ *
+ * @param str the attribute to search for.
+ * @return vector of the positions of the dependencies which contain the
+ * attribute, in the order of the dependency set.
+ * @details Only the posting list of the attribute and its list of the added
+ * dependencies are read, so the time does not depend on the number of the
+ * dependencies which do not contain the attribute.
+ */
+std::vector<itr_dep> DependencyIndex::find(const string &str) const {
+    unsigned int id;
+    if (!built || !dictionary.find(str, id))
+        return std::vector<itr_dep>();
+    std::vector<unsigned int> found;
+    if (id + 1 < offsets.size())
+        found.assign(postings.begin() + offsets[id], postings.begin() + offsets[id + 1]);
+    if (id < added.size())
+        found.insert(found.end(), added[id].begin(), added[id].end());
+    return collect(found);
+}
+
+/**
+ *
+ * @param as the attributes to search for.
+ * @return vector of the positions of the dependencies which contain at least
+ * one of the attributes, in the order of the dependency set.
+ * @details The posting lists of the attributes are concatenated, sorted and
+ * the duplicates are removed, so a dependency present in several lists is
+ * returned only once.
+ */
+std::vector<itr_dep> DependencyIndex::find(const set_str &as) const {
+    if (!built)
+        return std::vector<itr_dep>();
+    std::vector<unsigned int> found;
+    unsigned int id;
+    for (const string &str : as) {
+        if (!dictionary.find(str, id))
+            continue;
+        if (id + 1 < offsets.size())
+            found.insert(found.end(), postings.begin() + offsets[id],
+                postings.begin() + offsets[id + 1]);
+        if (id < added.size())
+            found.insert(found.end(), added[id].begin(), added[id].end());
+    }
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+    return collect(found);
+}
+
+/**
+ *
+ * @param found the indices of the dependencies in the increasing order.
+ * @return vector of the positions of the dependencies which are not removed,
+ * in the order of the dependency set.
+ * @details The indices below the number of the dependencies of the build are in
+ * the order of the dependency set. The added dependencies which follow them are
+ * sorted by themselves and merged into the others, so only the added
+ * dependencies are sorted.
+ */
+std::vector<itr_dep> DependencyIndex::collect(const std::vector<unsigned int> &found) const {
+    std::vector<itr_dep> ret;
+    ret.reserve(found.size());
+    unsigned int split = 0;
+    for (unsigned int d : found) {
+        if (removed[d])
+            continue;
+        if (d < base)
+            ++split;
+        ret.push_back(positions[d]);
+    }
+    if (split < ret.size()) {
+        auto less = [](itr_dep a, itr_dep b) {
+            return *a < *b;
+        };
+        std::sort(ret.begin() + split, ret.end(), less);
+        std::inplace_merge(ret.begin(), ret.begin() + split, ret.end(), less);
+    }
+    return ret;
+}
@@ -0,0 +1,138 @@
+/*! \file dependency_index.h
+ *
+ * \brief Includes declaration for the class DependencyIndex and its members.
+ *
+ * \details
+ * This file declares the definition of the class DependencyIndex along with its
+ * subsequent data members and the member functions prototype.
+ *
+ */
+#ifndef DEPENDENCY_INDEX_H
+#define DEPENDENCY_INDEX_H
+
+#include "declaration.h"
+#include "attribute_dictionary.h"
+
+#include <vector>
+#include <unordered_map>
+
+/*!
+ * \class DependencyIndex
+ * \brief The DependencyIndex class is an inverted index from every attribute to
+ * the dependencies of a dependency set which contain the attribute.
+ * \details The posting lists of all the attributes are stored one after another
+ * in a single array, in the compressed sparse row form, and the posting list of
+ * an attribute is the range between its offset and the offset of the next
+ * attribute. The postings are the positions of the dependencies in the order of
+ * the dependency set, so the dependencies containing any of several attributes
+ * are found by reading only their posting lists, without testing or marking
+ * every dependency. The index is built in two passes
+ * over the dependency set, the first counts the postings of every attribute and
+ * the second fills the array. The positions are the iterators of the indexed
+ * dependency set, so the index is kept in step with the set by the methods 
+ * DependencyIndex::insert and DependencyIndex::erase. A removed dependency is
+ * only marked, and the postings of an added one are kept in a separate list of
+ * its attributes, until their number is large compared to the size of the 
+ * index, when DependencyIndex::isCompact returns false and the index is to be 
+ * built again. Every build starts with an empty dictionary, so the attributes 
+ * which are no longer present are dropped.
+ */
+class DependencyIndex {
+public:
+
+    /**
+     * @brief Constructs the empty index.
+     */
+    DependencyIndex();
+
+    /**
+     * @brief A method to build the index for the dependency set.
+     */
+    void build(const set_dep &);
+
+    /**
+     * @brief A method to discard the index.
+     */
+    void clear(void);
+
+    /**
+     * @brief A method to check whether the index is built.
+     * @return true if the index is built and not cleared since, false otherwise.
+     */
+    bool isBuilt(void) const {
+        return built;
+    }
+
+    /**
+     * @brief A getter method to retrieve the number of the indexed dependencies.
+     * @return The number of the dependencies in the indexed dependency set.
+     */
+    unsigned int size(void) const {
+        return live;
+    }
+
+    /**
+     * @brief A method to check whether the index is worth keeping.
+     * @return true if the number of the dependencies added or removed since the
+     * build does not exceed the number of the indexed dependencies, false 
+     * otherwise.
+     */
+    bool isCompact(void) const {
+        return changes <= live + 16;
+    }
+
+    /**
+     * @brief A method to add the dependency inserted into the indexed set.
+     */
+    void insert(itr_dep);
+
+    /**
+     * @brief A method to remove the dependency before it is erased from the
+     * indexed set.
+     */
+    void erase(itr_dep);
+
+    /**
+     * @brief A method to find the dependencies which contain the attribute.
+     */
+    std::vector<itr_dep> find(const string &) const;
+
+    /**
+     * @brief A method to find the dependencies which contain any of the
+     * attributes.
+     */
+    std::vector<itr_dep> find(const set_str &) const;
+
+private:
+    AttributeDictionary dictionary; /*!< The identifiers of the attributes*/
+    std::vector<itr_dep> positions; /*!< The positions of the dependencies in
+                                     * the order of the dependency set*/
+    std::vector<unsigned int> offsets; /*!< The offset of the posting list of
+                                        * every attribute, followed by the
+                                        * total number of the postings*/
+    std::vector<unsigned int> postings; /*!< The indices of the dependencies
+                                         * of all the posting lists*/
+    std::vector<std::vector<unsigned int> > added; /*!< The indices of the 
+                                                    * dependencies added after 
+                                                    * the build, for every 
+                                                    * attribute*/
+    std::vector<bool> removed; /*!< Indicates whether the dependency at every 
+                                * index is removed*/
+    std::unordered_map<const Dependency*, unsigned int> slots; /*!< The index
+                                                                * of every 
+                                                                * present 
+                                                                * dependency*/
+    unsigned int base; /*!< The number of the dependencies of the build*/
+    unsigned int live; /*!< The number of the present dependencies*/
+    unsigned int changes; /*!< The number of the dependencies added or removed
+                           * since the build*/
+    bool built; /*!< Indicates whether the index is built*/
+
+    /**
+     * @brief A method to collect the present dependencies of the indices in
+     * the order of the dependency set.
+     */
+    std::vector<itr_dep> collect(const std::vector<unsigned int> &) const;
+};
+
+#endif /* DEPENDENCY_INDEX_H */
@@ -0,0 +1,135 @@
+/*! \file fd_table.cc
+ *
+ * \brief Includes definitions of the FDTable class members defined in the
+ * fd_table.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * FDTable.
+ *
+ */
+#include "fd_table.h"
+#include "dependency.h"
+
+/*!
+  \def BITS
+  Defines the number of bits in a word of the rows.
+ */
+#define BITS (8 * sizeof (FDTable::word))
+
+FDTable::FDTable() : words(0), built(false) {
+}
+
+/**
+ *
+ * @param attributes the attribute set of the relation.
+ * @param deps the dependency set of the relation.
+ * @details The attributes are interned first in the order of the attribute set,
+ * followed by the attributes of the dependencies which are not part of it. The
+ * rows are sized after all the attributes are interned. The postings of the lhs
+ * identifiers are counted while the rows are filled, and the posting lists are
+ * filled from the recorded identifiers in the order of the rows.
+ */
+void FDTable::build(const set_str &attributes, const set_dep &deps) {
+    dictionary = AttributeDictionary();
+    dictionary.intern(attributes);
+    positions.clear();
+    for (itr_dep i = deps.begin(); i != deps.end(); ++i) {
+        dictionary.intern(i->getAttribs());
+        positions.push_back(i);
+    }
+    words = (dictionary.size() + BITS - 1) / BITS;
+    lhs.assign(positions.size() * words, 0);
+    rhs.assign(positions.size() * words, 0);
+    sizes.assign(positions.size(), 0);
+    offsets.assign(dictionary.size() + 1, 0);
+    std::vector<unsigned int> ids;
+    unsigned int id;
+    for (unsigned int i = 0; i < positions.size(); ++i) {
+        word *l = lhs.data() + i * words, *r = rhs.data() + i * words;
+        for (const string &str : positions[i]->getLhs()) {
+            dictionary.find(str, id);
+            l[id / BITS] |= (word) 1 << (id % BITS);
+            ids.push_back(id);
+            ++offsets[id + 1];
+            ++sizes[i];
+        }
+        for (const string &str : positions[i]->getRhs()) {
+            dictionary.find(str, id);
+            r[id / BITS] |= (word) 1 << (id % BITS);
+        }
+    }
+    for (unsigned int a = 0; a < dictionary.size(); ++a) {
+        offsets[a + 1] += offsets[a];
+    }
+    postings.resize(offsets.back());
+    std::vector<unsigned int> next(offsets.begin(), offsets.end() - 1);
+    unsigned int k = 0;
+    for (unsigned int i = 0; i < positions.size(); ++i) {
+        for (unsigned int n = sizes[i]; n; --n) {
+            postings[next[ids[k++]]++] = i;
+        }
+    }
+    built = true;
+}
+
+/**
+ * @details The storage of the arrays is retained for the next build.
+ */
+void FDTable::clear(void) {
+    positions.clear();
+    sizes.clear();
+    built = false;
+}
+
+/**
+ *
+ * @param as the set of the attribute names.
+ * @return The row of bits of the identifiers of the names. The names which are
+ * not present in the dictionary are skipped.
+ */
+std::vector<FDTable::word> FDTable::toWords(const set_str &as) const {
+    std::vector<word> ret(words, 0);
+    unsigned int id;
+    for (const string &str : as) {
+        if (dictionary.find(str, id))
+            ret[id / BITS] |= (word) 1 << (id % BITS);
+    }
+    return ret;
+}
+
+/**
+ *
+ * @param x the row of bits, with the number of words of the table.
+ * @param first the index of the dependency from which the search starts.
+ * @return The index of the first dependency from the parameter first whose lhs
+ * attributes are all present in x, or the number of the dependencies if there
+ * is no such dependency.
+ * @details Calling the method again from the next index of the result finds
+ * all such dependencies in the order of the dependency set.
+ */
+unsigned int FDTable::findCovered(const std::vector<word> &x,
+        unsigned int first) const {
+    if (first >= size())
+        return size();
+    return first + AttrKernel::get().covered(x.data(), getLhs(first), words,
+            size() - first);
+}
+
+/**
+ *
+ * @param i the index of the dependency.
+ * @param x the row of bits, with the number of words of the table.
+ * @return true if at least one rhs attribute of the dependency is present in x,
+ * false otherwise.
+ */
+bool FDTable::intersectsRhs(unsigned int i, const std::vector<word> &x) const {
+    const word *r = getRhs(i);
+    for (unsigned int w = 0; w < words; ++w) {
+        if (r[w] & x[w])
+            return true;
+    }
+    return false;
+}
+
+#undef BITS
@@ -0,0 +1,186 @@
+/*! \file fd_table.h
+ *
+ * \brief Includes declaration for the class FDTable and its members.
+ *
+ * \details
+ * This file declares the definition of the class FDTable along with its
+ * subsequent data members and the member functions prototype.
+ *
+ */
+#ifndef FD_TABLE_H
+#define FD_TABLE_H
+
+#include "declaration.h"
+#include "attribute_dictionary.h"
+#include "attr_kernel.h"
+
+#include <vector>
+
+/*!
+ * \class FDTable
+ * \brief The FDTable class stores the dependency set of a relation in the
+ * structure of arrays form.
+ * \details Every attribute of the relation is interned into an
+ * AttributeDictionary, and the lhs and the rhs of every dependency are stored
+ * as the rows of bits with the same number of words. All the lhs rows are
+ * stored one after another in a single array, all the rhs rows in another one
+ * and the number of the lhs attributes in a parallel array, so a scan of the
+ * dependencies reads the memory sequentially instead of following the nodes of
+ * the sets of strings. The rows whose lhs is covered by an attribute set are
+ * found by the AttrKernel::covered function, which tests the rows with the SIMD
+ * instructions. The rows whose lhs contains an attribute are listed in the
+ * posting list of the attribute, and the posting lists of all the attributes
+ * are stored one after another in a single array, so the closure is calculated
+ * from the rows without any other copy of the dependencies. The position of
+ * every dependency in the dependency set is kept, so the rows are also a view
+ * of the dependency set in its order, and the table must be rebuilt when the
+ * set is modified.
+ */
+class FDTable {
+public:
+
+    typedef AttrKernel::word word; /*!< The type of a single word of bits*/
+
+    /**
+     * @brief Constructs the empty table.
+     */
+    FDTable();
+
+    /**
+     * @brief A method to build the table for the attribute set and the
+     * dependency set.
+     */
+    void build(const set_str &, const set_dep &);
+
+    /**
+     * @brief A method to discard the table.
+     */
+    void clear(void);
+
+    /**
+     * @brief A method to check whether the table is built.
+     * @return true if the table is built and not cleared since, false otherwise.
+     */
+    bool isBuilt(void) const {
+        return built;
+    }
+
+    /**
+     * @brief A getter method to retrieve the number of the dependencies.
+     * @return The number of the rows of the table.
+     */
+    unsigned int size(void) const {
+        return sizes.size();
+    }
+
+    /**
+     * @brief A getter method to retrieve the number of the words of a row.
+     * @return The number of the words of every lhs and rhs row.
+     */
+    unsigned int getWords(void) const {
+        return words;
+    }
+
+    /**
+     * @brief A getter method to retrieve the dictionary of the attributes.
+     * @return The constant reference of the AttributeDictionary of the table.
+     */
+    const AttributeDictionary& getDictionary(void) const {
+        return dictionary;
+    }
+
+    /**
+     * @brief A getter method to retrieve the lhs row of the dependency.
+     * @param i the index of the dependency.
+     * @return The pointer to the first word of the row.
+     */
+    const word* getLhs(unsigned int i) const {
+        return lhs.data() + i * words;
+    }
+
+    /**
+     * @brief A getter method to retrieve the rhs row of the dependency.
+     * @param i the index of the dependency.
+     * @return The pointer to the first word of the row.
+     */
+    const word* getRhs(unsigned int i) const {
+        return rhs.data() + i * words;
+    }
+
+    /**
+     * @brief A getter method to retrieve the number of the lhs attributes of
+     * the dependency.
+     * @param i the index of the dependency.
+     * @return The number of the bits set in the lhs row.
+     */
+    unsigned int getLhsSize(unsigned int i) const {
+        return sizes[i];
+    }
+
+    /**
+     * @brief A getter method to retrieve the position of the dependency in the
+     * dependency set.
+     * @param i the index of the dependency.
+     * @return The iterator of the dependency in the indexed dependency set.
+     */
+    itr_dep getDependency(unsigned int i) const {
+        return positions[i];
+    }
+
+    /**
+     * @brief A getter method to retrieve the start of the posting list of the
+     * identifier.
+     * @param id the identifier of the attribute.
+     * @return The offset of the first posting of the identifier, the list ends
+     * at the offset of the next identifier.
+     */
+    unsigned int getOffset(unsigned int id) const {
+        return offsets[id];
+    }
+
+    /**
+     * @brief A getter method to retrieve a posting of the lhs attributes.
+     * @param p the offset of the posting.
+     * @return The index of the dependency whose lhs contains the identifier of
+     * the posting list.
+     */
+    unsigned int getPosting(unsigned int p) const {
+        return postings[p];
+    }
+
+    /**
+     * @brief A method to convert the attribute names into a row of bits.
+     */
+    std::vector<word> toWords(const set_str &) const;
+
+    /**
+     * @brief A method to find the next dependency whose lhs is covered by the
+     * row of bits.
+     */
+    unsigned int findCovered(const std::vector<word> &, unsigned int) const;
+
+    /**
+     * @brief A method to check whether the rhs of the dependency contains any
+     * attribute of the row of bits.
+     */
+    bool intersectsRhs(unsigned int, const std::vector<word> &) const;
+
+private:
+    AttributeDictionary dictionary; /*!< The identifiers of the attributes*/
+    unsigned int words; /*!< The number of the words of every row*/
+    std::vector<word> lhs; /*!< The lhs rows of all the dependencies*/
+    std::vector<word> rhs; /*!< The rhs rows of all the dependencies*/
+    std::vector<unsigned int> sizes; /*!< The number of the lhs attributes of
+                                      * every dependency*/
+    std::vector<itr_dep> positions; /*!< The positions of the dependencies in
+                                     * the dependency set*/
+    std::vector<unsigned int> offsets; /*!< The offset of the posting list of
+                                        * every identifier, followed by the
+                                        * total number of the postings*/
+    std::vector<unsigned int> postings; /*!< The indices of the dependencies
+                                         * whose lhs contains the identifier,
+                                         * for all the identifiers*/
+    bool built; /*!< Indicates whether the table is built*/
+};
+
+#endif /* FD_TABLE_H */
@@ -0,0 +1,275 @@
+/*! \file fixed_attr_set.h
+ *
+ * \brief Includes declaration and definition for the class template
+ * FixedAttrSet and its members.
+ *
+ * \details
+ * This file declares the definition of the class template FixedAttrSet along
+ * with its subsequent data members and member functions. It also defines the
+ * overloaded versions of the global functions isSubset, isEqual and contains
+ * for the FixedAttrSet objects.
+ *
+ */
+#ifndef FIXED_ATTR_SET_H
+#define FIXED_ATTR_SET_H
+
+#include "declaration.h"
+
+/*!
+ * \class FixedAttrSet
+ * \brief The FixedAttrSet class template represents a set of attribute
+ * identifiers as a bit vector of compile-time width.
+ * \details The template parameter N is the number of identifiers the set can
+ * hold and must be a multiple of 64. The words are stored inside the object, so
+ * no memory is allocated from the heap and for N equal to 64 the whole set is a
+ * single machine word. The interface is same as of the class AttrSet, so the
+ * analysis methods can be instantiated for either of them. The identifiers
+ * greater than or equal to N are not supported.
+ */
+template <unsigned int N>
+class FixedAttrSet {
+public:
+
+    typedef unsigned long long word; /*!< The type of a single word of bits*/
+
+    static const unsigned int BITS = 64; /*!< The number of bits in a word*/
+
+    static const unsigned int WORDS = N / BITS; /*!< The number of words in the set*/
+
+    static const unsigned int npos = ~0u; /*!< The value returned when no more
+                                           * identifier is found*/
+
+    /**
+     * @brief Constructs the empty set.
+     * @details The parameter is accepted only to keep the interface same as of
+     * AttrSet, the capacity of the set is always N.
+     */
+    explicit FixedAttrSet(unsigned int = 0) {
+        clear();
+    }
+
+    /**
+     * @brief A method to add an identifier to the set.
+     * @param id the identifier to add.
+     * @return true if the identifier is inserted, false if it is already present.
+     */
+    bool insert(unsigned int id) {
+        word mask = (word) 1 << (id % BITS);
+        if (words[id / BITS] & mask)
+            return false;
+        words[id / BITS] |= mask;
+        return true;
+    }
+
+    /**
+     * @brief A method to remove an identifier from the set.
+     * @param id the identifier to remove.
+     * @return true if the identifier is removed, false if it is not present.
+     */
+    bool erase(unsigned int id) {
+        if (!contains(id))
+            return false;
+        words[id / BITS] &= ~((word) 1 << (id % BITS));
+        return true;
+    }
+
+    /**
+     * @brief A method to check whether the identifier is present in the set.
+     */
+    bool contains(unsigned int id) const {
+        return id < N && (words[id / BITS] >> (id % BITS) & 1);
+    }
+
+    /**
+     * @brief A method to check whether every identifier of the parameter is
+     * present in the set.
+     */
+    bool includes(const FixedAttrSet &right) const {
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            if (right.words[i] & ~words[i])
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief A method to check whether the set and the parameter have any
+     * common identifier.
+     */
+    bool intersects(const FixedAttrSet &right) const {
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            if (words[i] & right.words[i])
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief A method to calculate the number of identifiers in the set.
+     */
+    unsigned int size(void) const {
+        unsigned int count = 0;
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            count += __builtin_popcountll(words[i]);
+        }
+        return count;
+    }
+
+    /**
+     * @brief A method to check whether the set is empty.
+     */
+    bool empty(void) const {
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            if (words[i])
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief A method to remove all the identifiers from the set.
+     */
+    void clear(void) {
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            words[i] = 0;
+        }
+    }
+
+    /**
+     * @brief A method to find the smallest identifier present in the set which
+     * is greater than or equal to the parameter.
+     * @return The identifier, or FixedAttrSet::npos if there is no such identifier.
+     */
+    unsigned int next(unsigned int id) const {
+        unsigned int i = id / BITS;
+        if (i >= WORDS)
+            return npos;
+        word w = words[i] & (~(word) 0 << (id % BITS));
+        while (!w) {
+            if (++i >= WORDS)
+                return npos;
+            w = words[i];
+        }
+        return i * BITS + __builtin_ctzll(w);
+    }
+
+    /**
+     * @brief A method to find the smallest identifier present in the set.
+     */
+    unsigned int first(void) const {
+        return next(0);
+    }
+
+    /**
+     * @brief The overloaded operator |= to add all the identifiers of the
+     * parameter to the set.
+     */
+    FixedAttrSet& operator|=(const FixedAttrSet &right) {
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            words[i] |= right.words[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief The overloaded operator &= to keep only the identifiers which are
+     * present in the parameter.
+     */
+    FixedAttrSet& operator&=(const FixedAttrSet &right) {
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            words[i] &= right.words[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief The overloaded operator -= to remove all the identifiers of the
+     * parameter from the set.
+     */
+    FixedAttrSet& operator-=(const FixedAttrSet &right) {
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            words[i] &= ~right.words[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief The overloaded relational operator == to check equality between
+     * the two FixedAttrSet objects.
+     */
+    bool operator==(const FixedAttrSet &right) const {
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            if (words[i] != right.words[i])
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief The overloaded relational operator != to check inequality between
+     * the two FixedAttrSet objects.
+     */
+    bool operator!=(const FixedAttrSet &right) const {
+        return !(*this == right);
+    }
+
+    /**
+     * @brief The overloaded less operator for ordering the FixedAttrSet objects.
+     * @details The ordering is same as of AttrSet::operator <.
+     */
+    bool operator<(const FixedAttrSet &right) const {
+        unsigned int ls = size(), rs = right.size();
+        if (ls != rs)
+            return ls < rs;
+        for (unsigned int i = 0; i < WORDS; ++i) {
+            word diff = words[i] ^ right.words[i];
+            if (diff)
+                return (words[i] & diff & -diff) != 0;
+        }
+        return false;
+    }
+
+private:
+    word words[WORDS]; /*!< The words of the bit vector*/
+};
+
+template <unsigned int N>
+const unsigned int FixedAttrSet<N>::BITS;
+
+template <unsigned int N>
+const unsigned int FixedAttrSet<N>::WORDS;
+
+template <unsigned int N>
+const unsigned int FixedAttrSet<N>::npos;
+
+/**
+ * @brief Checks whether the second parameter is subset of the first parameter.
+ * @details A alternate version of the template function isSubset for
+ * FixedAttrSet.
+ */
+template <unsigned int N>
+inline bool isSubset(const FixedAttrSet<N> &lhs, const FixedAttrSet<N> &rhs) {
+    return lhs.includes(rhs);
+}
+
+/**
+ * @brief Checks the equality of two FixedAttrSet objects.
+ * @details A alternate version of the template function isEqual for
+ * FixedAttrSet.
+ */
+template <unsigned int N>
+inline bool isEqual(const FixedAttrSet<N> &lhs, const FixedAttrSet<N> &rhs) {
+    return lhs == rhs;
+}
+
+/**
+ * @brief Checks whether the identifier is present in the FixedAttrSet object.
+ * @details A alternate version of the template function contains for
+ * FixedAttrSet.
+ */
+template <unsigned int N>
+inline bool contains(const FixedAttrSet<N> &list, unsigned int val) {
+    return list.contains(val);
+}
+
+#endif /* FIXED_ATTR_SET_H */
@@ -0,0 +1,59 @@
+/*! \file key_generator.cc
+ *
+ * \brief Includes definitions of the KeyGenerator class members defined in the
+ * key_generator.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * KeyGenerator and its nested class iterator.
+ *
+ */
+#include "key_generator.h"
+#include "analyzer.h"
+
+/**
+ *
+ * @param analyzer the shared pointer of the Analyzer of the relation.
+ */
+KeyGenerator::KeyGenerator(const std::shared_ptr<const Analyzer> &analyzer) :
+analyzer(analyzer), position(0) {
+}
+
+/**
+ *
+ * @param key the set_str object where the next key is stored.
+ * @return true if the next key is found, false if all the keys are already
+ * retrieved.
+ * @details The keys are yielded in the order they are found by the Analyzer,
+ * and the search is continued only until the next key is found.
+ */
+bool KeyGenerator::next(set_str &key) {
+    if (!analyzer->getKey(position, key))
+        return false;
+    ++position;
+    return true;
+}
+
+/**
+ *
+ * @param generator the pointer of the generator. Default value is null, in
+ * which case the end iterator is constructed.
+ * @details The first key is retrieved from the generator, and if there is no
+ * key then the end iterator is constructed.
+ */
+KeyGenerator::iterator::iterator(KeyGenerator *generator) :
+generator(generator) {
+    if (generator && !generator->next(key))
+        this->generator = 0;
+}
+
+/**
+ *
+ * @return The reference of the iterator.
+ * @details The iterator becomes the end iterator after the last key.
+ */
+KeyGenerator::iterator& KeyGenerator::iterator::operator++() {
+    if (!generator->next(key))
+        generator = 0;
+    return *this;
+}
@@ -0,0 +1,120 @@
+/*! \file key_generator.h
+ *
+ * \brief Includes declaration for the class KeyGenerator and its members.
+ *
+ * \details
+ * This file declares the definition of the class KeyGenerator along with its
+ * subsequent data members and the member functions prototype.
+ *
+ */
+#ifndef KEY_GENERATOR_H
+#define KEY_GENERATOR_H
+
+#include "declaration.h"
+
+#include <iterator>
+#include <memory>
+
+/*!
+ * \class KeyGenerator
+ * \brief The KeyGenerator class yields the candidate keys of a relation one at
+ * a time.
+ * \details The object is returned by the method Relation::keys. The keys are
+ * searched only when the next key is requested, so the caller which needs only
+ * a few keys can stop the search early, and the keys need not to be stored by
+ * the caller. The generator shares the Analyzer of the relation, so the keys
+ * found by the generator are not searched again by the other methods of the
+ * relation, and the generator continues to yield the keys of the relation as
+ * it was when the generator is created even if the relation is modified. The
+ * keys can be retrieved by the method KeyGenerator::next, or by the iterators
+ * in the range-based for loop.
+ */
+class KeyGenerator {
+public:
+
+    /*!
+     * \class iterator
+     * \brief The input iterator over the keys of the KeyGenerator.
+     */
+    class iterator : public std::iterator<std::input_iterator_tag, set_str> {
+    public:
+
+        /**
+         * @brief Constructs the iterator at the first key of the generator, or
+         * the end iterator if the parameter is null.
+         */
+        explicit iterator(KeyGenerator * = 0);
+
+        /**
+         * @brief The dereference operator to retrieve the current key.
+         * @return The constant reference of the current key.
+         */
+        const set_str& operator*() const {
+            return key;
+        }
+
+        /**
+         * @brief The member access operator to access the current key.
+         * @return The constant pointer of the current key.
+         */
+        const set_str* operator->() const {
+            return &key;
+        }
+
+        /**
+         * @brief The prefix increment operator to advance to the next key.
+         */
+        iterator& operator++();
+
+        /**
+         * @brief The equality operator, true if both are the end iterators or
+         * both iterate the same generator.
+         */
+        bool operator==(const iterator &right) const {
+            return generator == right.generator;
+        }
+
+        /**
+         * @brief The inequality operator.
+         */
+        bool operator!=(const iterator &right) const {
+            return generator != right.generator;
+        }
+
+    private:
+        KeyGenerator *generator; /*!< The generator, null at the end*/
+        set_str key; /*!< The current key*/
+    };
+
+    /**
+     * @brief Constructs the generator over the keys found by the Analyzer.
+     */
+    explicit KeyGenerator(const std::shared_ptr<const Analyzer> &);
+
+    /**
+     * @brief A method to retrieve the next candidate key.
+     */
+    bool next(set_str &);
+
+    /**
+     * @brief A method to retrieve the iterator at the next key.
+     * @return The iterator which yields the remaining keys.
+     */
+    iterator begin() {
+        return iterator(this);
+    }
+
+    /**
+     * @brief A method to retrieve the end iterator.
+     * @return The iterator which represents the end of the keys.
+     */
+    iterator end() {
+        return iterator();
+    }
+
+private:
+    std::shared_ptr<const Analyzer> analyzer; /*!< The Analyzer of the relation*/
+    unsigned int position; /*!< The position of the next key*/
+};
+
+#endif /* KEY_GENERATOR_H */
@@ -0,0 +1,55 @@
+/*! \file key_search.h
+ *
+ * \brief Includes declaration for the structs KeySearchOptions and
+ * KeySearchResult.
+ *
+ * \details
+ * This file declares the definition of the structs used to limit the candidate
+ * key search and to return its result.
+ *
+ */
+#ifndef KEY_SEARCH_H
+#define KEY_SEARCH_H
+
+#include "declaration.h"
+
+/*!
+ * \struct KeySearchOptions
+ * \brief The KeySearchOptions struct represents the limits of the candidate
+ * key search.
+ * \details The value zero of a member means the search is not limited by it,
+ * so the default constructed object represents the unlimited search. The
+ * limited search follows the key engine of the relation, except that a search
+ * with the limit of the key size is always the level wise search: the
+ * Lucchesi-Osborn algorithm derives the smaller keys from the larger ones, so
+ * it could only filter the keys after they are found, while the level wise
+ * search never generates the sets larger than the limit.
+ */
+struct KeySearchOptions {
+    unsigned int maxKeySize; /*!< The maximum number of the attributes of the
+                              * reported keys*/
+    unsigned int maxKeys; /*!< The maximum number of the reported keys*/
+    unsigned long timeLimit; /*!< The wall-clock time of the search, in the
+                              * milliseconds*/
+    unsigned long maxNodes; /*!< The maximum number of the attribute sets
+                             * examined by the search*/
+
+    /**
+     * @brief Constructs the options of the unlimited search.
+     */
+    KeySearchOptions() : maxKeySize(0), maxKeys(0), timeLimit(0), maxNodes(0) {
+    }
+};
+
+/*!
+ * \struct KeySearchResult
+ * \brief The KeySearchResult struct represents the result of the limited
+ * candidate key search.
+ */
+struct KeySearchResult {
+    set_key keys; /*!< The candidate keys found within the limits*/
+    bool complete; /*!< Indicates whether every key within the limits of the
+                    * size and the number of the keys is found*/
+};
+
+#endif /* KEY_SEARCH_H */
@@ -11,10 +11,15 @@
 #include "utility.h"
 #include "dependency.h"
 #include "violation.h"
+#include "analyzer.h"
+#include "set_trie.h"
+#include "cover_engine.h"
 
 #include <functional> 
 #include <algorithm>
 #include <vector>
+#include <unordered_map>
+#include <utility>
 using std::vector;
 
 #include<iomanip>
@@ -23,68 +28,75 @@ using std::vector;
  * 
  * @param rset a set_rel representing the set of the sub relation. All the 
  * decomposed sub relation will be added to this set.
- * @param r a relation object which is to be decomposed into the sub-relations.
+ * @param str the name of the sub-relation which is to be decomposed.
+ * @param attribs the attribute set of the sub-relation which is to be decomposed.
  * @param details a boolean parameter with default value false. If true the steps
  * involved in the decomposition will be printed on standard output stream cout.
- * @details This is a recursive static function. If the relation parameter r is 
- * not in the BCNF, then it uses the algorithm for the non-preserving FD decomposition
- * algorithm to construct the sub-relation and repeats the procedure until all 
- * the sub-relations are in BCNF.
- * 
+ * @details This is a recursive function. The sub-relation is the projection of
+ * the current relation on attribs, and it is not constructed while it is
+ * decomposed further. The projection of a projection is the projection of the
+ * current relation on the smaller attribute set, so every level of the
+ * recursion shares the FDTable of the current relation, and only the attribute
+ * set is kept for every level. The dependencies of the sub-relation are the rows
+ * of the table covered by attribs, in the order of the dependency set, and the
+ * Analyzer of the projection, which reads the same table, tests whether their
+ * lhs is a superkey. If the sub-relation is not in the BCNF, then it uses the
+ * algorithm for the non-preserving FD decomposition algorithm on the first
+ * violation and repeats the procedure until all the sub-relations are in BCNF.
+ * Only the sub-relations in BCNF are constructed, or every sub-relation if the
+ * details are printed.
  */
-void Relation::decompose(set_rel &rset, const Relation &r, bool details) {
-    if (r.isNormal(Relation::_BCNF)) {
-        rset.insert(r);
+void Relation::decompose(set_rel &rset, const string &str, const set_str &attribs,
+        bool details) const {
+    const FDTable &t = *getTable();
+    std::shared_ptr<const Analyzer> a = Analyzer::create(*this, getTable(), attribs);
+    std::vector<FDTable::word> x = t.toWords(attribs);
+    unsigned int i = t.findCovered(x, 0);
+    while (i < t.size() && !(t.intersectsRhs(i, x)
+            && !a->isSuperkey(t.getDependency(i)->getLhs()))) {
+        i = t.findCovered(x, i + 1);
+    }
+    if (i == t.size()) {
+        Relation r = subRelation(str, attribs);
         if (details) {
             std::cout << std::endl << std::setw(WIDTH) << std::right << ""
                     << std::endl << std::setw(WIDTH) << std::right << "" << "Sub-relation added: " << r << std::endl;
             std::cout << std::setw(WIDTH) << std::right << "" << "Candidate key: " << r.getCandidatekey() << std::endl;
         }
+        rset.insert(std::move(r));
         return;
     }
-    set_dep v = r.getViolation(Relation::_BCNF);
 
     if (details) {
+        Relation r = subRelation(str, attribs);
         std::cout << std::endl << std::setw(WIDTH) << std::right << "" << "Relation is not in BCNF : " << r << std::endl;
         std::cout << std::setw(WIDTH) << std::right << "" << "Candidate key: " << r.getCandidatekey() << std::endl;
-        std::cout << std::setw(WIDTH) << std::right << "" << "Violations " << v << std::endl;
+        std::cout << std::setw(WIDTH) << std::right << "" << "Violations " << r.getViolation(Relation::_BCNF) << std::endl;
     }
-    const Dependency& d = *(v.begin());
-    set_str list = r.getAttributes();
-    set_str dep = d.getAttribs();
-    list -= d.getRhs();
-    Relation r1((r.getName() + "1"), list);
-    r1.addDependencies(r.getDependencies(), false);
-
-    Relation r2((r.getName() + "2"), dep);
-    r2.addDependencies(r.getDependencies(), false);
-
-    Relation::decompose(rset, r1, details);
-    Relation::decompose(rset, r2, details);
-}
-
-/**
- * 
- * @param keys A set of existing working set in candidate key calculation.
- * @param atribs The attribute set referred to calculate the next iteration of 
- * working set in candidate key calculation.
- * @details This is the static method to calculate the next working set in 
- * candidate key calculation. The working set involves all the possible combination 
- * of relation attribute which is to be tested to determine the candidate key.
- * The next iteration of working set will be constructed by adding one of the 
- * remaining attribute to find out all the possible combinations.
- */
-void Relation::getNextIteration(set_key& keys, const set_str& atribs) {
-    set_key ret;
-    for (itr_key i = keys.begin(); i != keys.end(); ++i) {
-        for (itr_str j = atribs.begin(); j != atribs.end(); ++j) {
-            set_str s = *i;
-            if (s.insert(*j).second)
-                ret.insert(s);
-        }
+    const Dependency& d = *t.getDependency(i);
+    set_str list = attribs;
+    set_str dep = d.getLhs();
+    for (const string &attr : d.getRhs()) {
+        if (list.erase(attr))
+            dep.insert(attr);
     }
-    keys.clear();
-    keys = ret;
+    decompose(rset, str + "1", list, details);
+    decompose(rset, str + "2", dep, details);
+}
+
+/**
+ * 
+ * @param str the name of the sub-relation.
+ * @param attribs the attribute set of the sub-relation, a subset of the 
+ * attribute set of the current relation.
+ * @return The sub-relation with the dependencies of Relation::project and the 
+ * key engine of the current relation.
+ */
+Relation Relation::subRelation(const string &str, const set_str &attribs) const {
+    Relation r(str, attribs);
+    r.setKeyEngine(engine);
+    r.addDependencies(project(attribs), false);
+    return r;
 }
 
 /**
@@ -100,7 +112,8 @@ void Relation::getNextIteration(set_key& keys, const set_str& atribs) {
  * object will have an empty dependency set, if the dep parameter is not provided.
  */
 Relation::Relation(const string &str, const set_str &attribs, const set_dep &dep) :
-name(str), attributes(attribs) {
+name(str), attributes(attribs), engine(_LUCCHESI_OSBORN), closureHits(0),
+closureMisses(0) {
     addDependencies(dep);
 }
 
@@ -109,11 +122,86 @@ name(str), attributes(attribs) {
  * @param orig is the constant reference to the Relation object from which the 
  * data members used to initialize newly constructed object.
  * @details The copy constructor uses all the data member from the parameter orig
- * and initialize the data members of new object.
+ * and initialize the data members of new object. The dependency set of orig is
+ * already reduced for its attribute set, so it is copied as it is and only the 
+ * index of the lhs is rebuilt to refer to the copied set.
  */
 Relation::Relation(const Relation& orig) :
-name(orig.name), attributes(orig.attributes) {
-    addDependencies(orig.dependencies);
+name(orig.name), attributes(orig.attributes), dependencies(orig.dependencies),
+engine(orig.engine), closureHits(0), closureMisses(0) {
+    indexDependencies();
+}
+
+/**
+ * 
+ * @param orig is the Relation object whose data members are moved to the newly 
+ * constructed object.
+ * @details The nodes of the sets are taken over, so the positions stored by the
+ * index of the lhs, the DependencyIndex and the FDTable remain valid and are
+ * moved along with the sets, and so is the Analyzer which shares the FDTable.
+ * The parameter is left as an empty relation.
+ */
+Relation::Relation(Relation&& orig) :
+name(std::move(orig.name)), attributes(std::move(orig.attributes)),
+dependencies(std::move(orig.dependencies)), lhsIndex(std::move(orig.lhsIndex)),
+attributeIndex(std::move(orig.attributeIndex)), table(std::move(orig.table)),
+engine(orig.engine), analyzer(std::move(orig.analyzer)),
+closureHits(orig.closureHits), closureMisses(orig.closureMisses) {
+    orig.dependencies.clear();
+    orig.lhsIndex.clear();
+    orig.attributeIndex.clear();
+    orig.invalidate();
+    orig.closureHits = orig.closureMisses = 0;
+}
+
+/**
+ * 
+ * @param right is the constant reference to the Relation object from which the 
+ * data members are assigned.
+ * @return The reference of the current relation object.
+ * @details Same as the copy constructor, the dependency set is copied and the 
+ * index of the lhs is rebuilt for the dependency set of the current object.
+ */
+Relation& Relation::operator=(const Relation& right) {
+    if (this == &right)
+        return *this;
+    name = right.name;
+    attributes = right.attributes;
+    engine = right.engine;
+    invalidate();
+    attributeIndex.clear();
+    dependencies = right.dependencies;
+    indexDependencies();
+    return *this;
+}
+
+/**
+ * 
+ * @param right is the Relation object whose data members are moved.
+ * @return The reference of the current relation object.
+ * @details Same as the move constructor, the data members and the cache counts
+ * of the parameter replace the ones of the current object, whose Analyzer is
+ * discarded along with its counts.
+ */
+Relation& Relation::operator=(Relation&& right) {
+    if (this == &right)
+        return *this;
+    name = std::move(right.name);
+    attributes = std::move(right.attributes);
+    dependencies = std::move(right.dependencies);
+    lhsIndex = std::move(right.lhsIndex);
+    attributeIndex = std::move(right.attributeIndex);
+    table = std::move(right.table);
+    engine = right.engine;
+    analyzer = std::move(right.analyzer);
+    closureHits = right.closureHits;
+    closureMisses = right.closureMisses;
+    right.dependencies.clear();
+    right.lhsIndex.clear();
+    right.attributeIndex.clear();
+    right.invalidate();
+    right.closureHits = right.closureMisses = 0;
+    return *this;
 }
 
 /**
@@ -126,6 +214,133 @@ Relation::~Relation() {
     attributes.clear();
 }
 
+/**
+ * 
+ * @return The constant reference of the Analyzer object for the current state 
+ * of the relation.
+ * @details The Analyzer is created on the first call after the relation is
+ * created or modified, and the same object is shared by all the following calls
+ * until the relation is modified again. The width of its attribute set type is
+ * selected by Analyzer::create from the number of attributes. The Analyzer
+ * reads the dependencies from the FDTable of the relation.
+ */
+const Analyzer& Relation::getAnalyzer(void) const {
+    if (!analyzer)
+        analyzer = Analyzer::create(*this, getTable());
+    return *analyzer;
+}
+
+/**
+ * @details This method is called by every method which modifies the attribute 
+ * set or the dependency set, so that the next analysis uses the current state 
+ * of the relation. The closure cache is discarded along with the Analyzer, and
+ * its hit and miss counts are added to the counts of the relation. The FDTable
+ * is released by the relation, but it is kept alive by the Analyzer objects
+ * still in use, such as the one of a KeyGenerator, so the next table is built
+ * as a new object.
+ */
+void Relation::invalidate(void) {
+    if (analyzer) {
+        closureHits += analyzer->getCacheHits();
+        closureMisses += analyzer->getCacheMisses();
+    }
+    analyzer.reset();
+    table.reset();
+}
+
+/**
+ * 
+ * @return The constant reference of the DependencyIndex object for the current
+ * dependency set of the relation.
+ * @details The index is built on the first call, and it is kept in step with
+ * the dependency set by Relation::insertDependency and Relation::eraseDependency
+ * afterwards, which are used by every method modifying the dependency set. It
+ * is built again only when the dependency set is replaced as a whole, which
+ * discards the index, or when it is no longer compact.
+ */
+const DependencyIndex& Relation::getAttributeIndex(void) const {
+    if (!attributeIndex.isBuilt() || !attributeIndex.isCompact())
+        attributeIndex.build(dependencies);
+    return attributeIndex;
+}
+
+/**
+ *
+ * @return The shared pointer to the FDTable object for the current attribute
+ * set and dependency set of the relation.
+ * @details The table is built on the first call after the relation is modified,
+ * as it is released along with the Analyzer by every modification.
+ */
+const std::shared_ptr<const FDTable>& Relation::getTable(void) const {
+    if (!table) {
+        std::shared_ptr<FDTable> t = std::make_shared<FDTable>();
+        t->build(attributes, dependencies);
+        table = t;
+    }
+    return table;
+}
+
+/**
+ * 
+ * @param attribs the attribute set on which the dependencies are projected.
+ * @return set_dep object containing the dependencies whose lhs is subset of the
+ * parameter, with the rhs restricted to the parameter.
+ * @details The dependencies whose lhs is covered by the parameter are found by
+ * FDTable::findCovered, which tests the lhs rows of the table with the SIMD 
+ * instructions. The result is same as the dependencies accepted by 
+ * Relation::addDependencies without the update by a relation with the parameter
+ * as its attribute set.
+ */
+set_dep Relation::project(const set_str &attribs) const {
+    set_dep ret;
+    const FDTable &t = *getTable();
+    std::vector<FDTable::word> x = t.toWords(attribs);
+    for (unsigned int i = t.findCovered(x, 0); i < t.size(); i = t.findCovered(x, i + 1)) {
+        itr_dep j = t.getDependency(i);
+        Dependency d(j->lhs, set_str());
+        for (const string &str : j->rhs) {
+            if (contains(attribs, str))
+                d.rhs.insert(d.rhs.end(), str);
+        }
+        if (!d.rhs.empty())
+            ret.insert(d);
+    }
+    return ret;
+}
+
+/**
+ * 
+ * @param engine the Relation::KeyEngine value of the algorithm to be used.
+ * @details The Relation::_LUCCHESI_OSBORN algorithm is used by default. The
+ * Relation::_LEVELWISE algorithm is retained for the comparison of the results.
+ * The Relation::_PARALLEL algorithm performs the level wise search using all
+ * the hardware threads, and returns the same keys as Relation::_LEVELWISE.
+ */
+void Relation::setKeyEngine(const KeyEngine engine) {
+    if (this->engine != engine) {
+        this->engine = engine;
+        invalidate();
+    }
+}
+
+/**
+ * 
+ * @return The number of the closures found in the cache since the relation is
+ * created, including the closures calculated for the candidate keys.
+ */
+unsigned long Relation::getClosureHits() const {
+    return closureHits + (analyzer ? analyzer->getCacheHits() : 0);
+}
+
+/**
+ * 
+ * @return The number of the closures calculated since the relation is created,
+ * including the closures calculated for the candidate keys.
+ */
+unsigned long Relation::getClosureMisses() const {
+    return closureMisses + (analyzer ? analyzer->getCacheMisses() : 0);
+}
+
 /**
  * 
  * @param str a string set parameter represents the lhs value to search for.
@@ -133,42 +348,113 @@ Relation::~Relation() {
  * set if the dependency is found with same lhs as the parameter. It returns the
  * set::end iterator of the attribute set if the parameter is not equal to the 
  * any of dependency object's lhs form the dependency set of the relation.
+ * @details The dependency is found by the hash index of the lhs, which is kept
+ * exactly in step with the dependency set by Relation::insertDependency and
+ * Relation::eraseDependency, and rebuilt by the copy constructor and the copy
+ * assignment for the copied set.
  */
 itr_dep Relation::findDepLHS(const set_str &str) const {
-    return (find_if(dependencies.begin(), dependencies.end(),
-            [ & ] (const Dependency & d) {
-                return (isEqual(d.lhs, str));
-            }));
+    auto i = lhsIndex.find(str);
+    return i == lhsIndex.end() ? dependencies.end() : i->second;
+}
+
+/**
+ * @details Every lhs is present only once in the dependency set, so the index 
+ * has one entry for every dependency.
+ */
+void Relation::indexDependencies(void) {
+    lhsIndex.clear();
+    lhsIndex.reserve(dependencies.size());
+    for (itr_dep i = dependencies.begin(); i != dependencies.end(); ++i) {
+        lhsIndex.insert(std::make_pair(i->lhs, i));
+    }
+}
+
+/**
+ * 
+ * @param i the position of the dependency in the dependency set.
+ * @return The position of the dependency following the removed one.
+ */
+itr_dep Relation::eraseDependency(itr_dep i) {
+    auto j = lhsIndex.find(i->lhs);
+    if (j != lhsIndex.end() && j->second == i)
+        lhsIndex.erase(j);
+    attributeIndex.erase(i);
+    return dependencies.erase(i);
+}
+
+/**
+ * 
+ * @param d the dependency to be inserted, whose lhs is not present in the 
+ * dependency set.
+ * @return The position of the inserted dependency.
+ * @details The dependency is added to the index of the lhs and to the index of
+ * the attributes.
+ */
+itr_dep Relation::insertDependency(Dependency &&d) {
+    itr_dep i = dependencies.insert(std::move(d)).first;
+    lhsIndex[i->lhs] = i;
+    attributeIndex.insert(i);
+    return i;
 }
 
 /**
  * @details This method will combined all the rhs set into one dependency object,
  * from the dependency set of the relation, if multiple dependency have same lhs
- * set.
+ * set. The dependencies are grouped by their lhs in a hash table in one pass,
+ * and only the dependencies of a shared lhs are replaced by the combined one,
+ * through Relation::eraseDependency and Relation::insertDependency, so the
+ * indices are updated in place. The time is O(n log n) for n dependencies.
  */
 void Relation::reducedDependencies(void) {
-    for (itr_dep i = dependencies.begin(); i != dependencies.end();) {
-        unsigned int count = count_if(dependencies.begin(), dependencies.end(),
-                [ & ] (const Dependency & d) {
-                    return (isEqual(d.lhs, i->lhs));
-                });
-        if (count > 1) {
-            set_str lhs = i->lhs;
-            set_str rhs = i->rhs;
-            for_each(dependencies.begin(), dependencies.end(),
-                    [ & ] (const Dependency & d) {
-                        if (isEqual(d.lhs, lhs)) {
-                            rhs.insert(d.rhs.begin(), d.rhs.end());
-                        }
-                    });
-            Dependency d(lhs, rhs);
-            dependencies.insert(d);
-            dependencies.erase(i++);
-        } else {
-            ++i;
+    std::unordered_map<set_str, std::vector<itr_dep>, setstr_hash> groups;
+    groups.reserve(dependencies.size());
+    for (itr_dep i = dependencies.begin(); i != dependencies.end(); ++i) {
+        groups[i->lhs].push_back(i);
+    }
+    if (groups.size() == dependencies.size())
+        return;
+    for (const auto &g : groups) {
+        if (g.second.size() < 2)
+            continue;
+        set_str rhs;
+        for (itr_dep i : g.second) {
+            rhs.insert(i->rhs.begin(), i->rhs.end());
+            eraseDependency(i);
         }
+        insertDependency(Dependency(g.first, rhs));
+    }
+    invalidate();
+}
 
+/**
+ * 
+ * @param d the dependency to be added, modified in place.
+ * @param update the boolean value indicating whether the attributes of the 
+ * dependency which are not part of the attribute set are to be added to it.
+ * @return true if the dependency can be added, false otherwise.
+ * @details If the update value is false, the rhs attributes which are not part
+ * of the attribute set are removed from the dependency, and the dependency is 
+ * rejected if its lhs is not part of the attribute set or its rhs becomes empty.
+ */
+bool Relation::admitDependency(Dependency &d, bool update) {
+    if (isSubset(attributes, d.getAttribs()))
+        return true;
+    if (update) {
+        set_str ss = d.getAttribs();
+        attributes.insert(ss.begin(), ss.end());
+        invalidate();
+        return true;
+    }
+    if (!isSubset(attributes, d.lhs))
+        return false;
+    for (itr_str i = d.rhs.begin(); i != d.rhs.end();) {
+        if (!contains(attributes, *i))
+            d.rhs.erase(i++);
+        else
+            ++i;
     }
+    return !d.rhs.empty();
 }
 
 /**
@@ -233,37 +519,25 @@ itr_dep Relation::addDependency(const set_str &lhs, const set_str &rhs, bool upd
  * false and only rhs is not subset of relation attribute set then the only those
  * attributes from the rhs which are part of the attribute set will be considered 
  * and all other attributes will be discarded from rhs and then the dependency 
- * will be inserted into the dependency set. Note that if dependency is inserted 
- * into the dependency set then private method Relation::reduceDependecy will be
- * used to minimize the dependency set with same lhs values and the resultant 
- * position of the newly inserted dependency will be returned.
+ * will be inserted into the dependency set. Note that if the dependency set 
+ * already contains a dependency with the same lhs, the rhs of the both are 
+ * combined into one dependency and the position of the combined dependency will
+ * be returned.
  */
 itr_dep Relation::addDependency(const Dependency &dep, bool update) {
 
     Dependency d(dep);
-    if (!isSubset(attributes, dep.getAttribs())) {
-        if (update) {
-            set_str ss = dep.getAttribs();
-            attributes.insert(ss.begin(), ss.end());
-        } else {
-            if (isSubset(attributes, d.lhs)) {
-
-                for (itr_str i = d.rhs.begin(); i != d.rhs.end();) {
-                    if (!contains(attributes, *i))
-                        d.rhs.erase(i++);
-                    else
-                        ++i;
-                }
-                if (d.rhs.empty())
-                    return dependencies.end();
-            } else {
-                return dependencies.end();
-            }
-        }
+    if (!admitDependency(d, update))
+        return dependencies.end();
+    itr_dep i = findDepLHS(d.lhs);
+    if (i != dependencies.end()) {
+        if (isSubset(i->rhs, d.rhs))
+            return i;
+        d.rhs.insert(i->rhs.begin(), i->rhs.end());
+        eraseDependency(i);
     }
-    dependencies.insert(d);
-    reducedDependencies();
-    return this->findDepLHS(dep.lhs);
+    invalidate();
+    return insertDependency(std::move(d));
 }
 
 /**
@@ -274,10 +548,11 @@ itr_dep Relation::addDependency(const Dependency &dep, bool update) {
  * set are subset of the attribute set of the relation object, false otherwise.
  */
 bool Relation::isDepAttribPresent(const Dependency &dep) const {
-    return (count_if(attributes.begin(), attributes.end(),
+    set_str as = dep.getAttribs();
+    return (find_if(as.begin(), as.end(),
             [ & ] (const string & s) {
-                return dep.isPresent(s);
-            }) > 0);
+                return contains(attributes, s);
+            }) != as.end());
 }
 
 /**
@@ -308,8 +583,12 @@ bool Relation::removeDependency(const set_str &lhs, const set_str &rhs) {
  * to remove or modify then the false value will be returned.
  */
 bool Relation::removeDependency(const Dependency &dep) {
-    if (dependencies.erase(dep) != 0)
+    itr_dep e = dependencies.find(dep);
+    if (e != dependencies.end()) {
+        eraseDependency(e);
+        invalidate();
         return true;
+    }
     itr_dep i = findDepLHS(dep.lhs);
     bool ret = false;
     if (i != dependencies.end()) {
@@ -318,7 +597,8 @@ bool Relation::removeDependency(const Dependency &dep) {
             ret = d.removeRhs(str) && !ret ? true : ret;
         }
         if (ret) {
-            dependencies.erase(i);
+            eraseDependency(i);
+            invalidate();
             ret = true;
             if (!d.rhs.empty())
                 addDependency(d);
@@ -337,8 +617,10 @@ bool Relation::removeDependency(const Dependency &dep) {
  * attribute set.
  */
 bool Relation::addAtributte(const string &str) {
-    if (!str.empty())
-        return (attributes.insert(str).second);
+    if (!str.empty() && attributes.insert(str).second) {
+        invalidate();
+        return true;
+    }
     return false;
 }
 
@@ -350,9 +632,12 @@ bool Relation::addAtributte(const string &str) {
  * relation object attribute set, false otherwise.
  */
 unsigned int Relation::addAtributtes(const set_str &as) {
-    return count_if(as.begin(), as.end(), [&] (const string & str) {
+    unsigned int count = count_if(as.begin(), as.end(), [&] (const string & str) {
         return (this->attributes.insert(str).second);
     });
+    if (count)
+        invalidate();
+    return count;
 }
 
 /**
@@ -362,33 +647,37 @@ unsigned int Relation::addAtributtes(const set_str &as) {
  * @return true if attribute is removed from the set, false otherwise.
  * @details If the attribute is not found in the attribute set of the relation
  * object then no attribute will be removed. If it is found in the relation then
- * the attribute will be removed. The dependency set will be searched to find out 
- * dependencies which contains the removed attribute. If the attribute present in
+ * the attribute will be removed. The dependencies which contains the removed 
+ * attribute are found by the index of the attributes, which is updated by the
+ * removal and the addition of the dependencies, so it is kept for the next 
+ * removal. If the attribute present in
  * lhs part of the dependency the entire dependency will be removed from dependency
  * set. If the attribute is found only in rhs set of the dependency, then the attribute
  * will be removed from rhs as well.
  */
 bool Relation::removeAtributte(const string &str) {
     set_dep temp;
-    for (itr_dep i = dependencies.begin(); i != dependencies.end();) {
-        if (i->isPresent(str)) {
-            if (!i->isPresentLhs(str)) {
-                Dependency d(*i);
-                d.removeRhs(str);
-                if (!d.rhs.empty())
-                    temp.insert(d);
-            }
-            dependencies.erase(i++);
-        } else {
-            ++i;
+    std::vector<itr_dep> found = getAttributeIndex().find(str);
+    for (itr_dep i : found) {
+        if (!i->isPresentLhs(str)) {
+            Dependency d(*i);
+            d.removeRhs(str);
+            if (!d.rhs.empty())
+                temp.insert(d);
         }
+        eraseDependency(i);
     }
+    if (!found.empty())
+        invalidate();
 
     if (!temp.empty()) {
         this->addDependencies(temp, false);
     }
 
-    return (attributes.erase(str) != 0);
+    if (attributes.erase(str) == 0)
+        return false;
+    invalidate();
+    return true;
 }
 
 /**
@@ -400,41 +689,44 @@ bool Relation::removeAtributte(const string &str) {
  * decompose the relation into the sub-relations and returns the set of such relations.
  * The decomposed sub relation will have all the dependencies which can preserve 
  * the original dependency set. It will also ensures that each sub-relation is in
- * at least 3NF.
+ * at least 3NF. The candidate keys are not enumerated, the dependency which 
+ * contains a candidate key is found by the superkey test and the key of the 
+ * additional sub-relation is found by Relation::getAnyCandidateKey. The minimal
+ * cover is stored once in a relation, and every sub-relation is its projection 
+ * found by the FDTable of the cover, instead of filtering the whole cover for 
+ * every sub-relation.
  */
 set_rel Relation::decomposePreserving(bool details) const {
     set_rel ret;
     set_dep mc = getMinimalCover(details);
     unsigned int i = 0;
-    set_key keys = getCandidatekey();
-    itr_dep found = find_if(mc.begin(), mc.end(), [&] (const Dependency d) {
-        return testSet(keys, d.getAttribs(), true);
+    SetTrie<string> index;
+    itr_dep found = find_if(mc.begin(), mc.end(), [&] (const Dependency &d) {
+        return isSuperkey(d.getAttribs());
     });
+    Relation cover(name, attributes, mc);
+    cover.setKeyEngine(engine);
 
     if (mc.end() == found) {
-        Relation r((this->name + std::to_string(++i)), *keys.begin());
-        r.addDependencies(mc, false);
-        ret.insert(r);
+        Relation r = cover.subRelation(this->name + std::to_string(++i), getAnyCandidateKey());
+        index.insert(r.attributes.begin(), r.attributes.end());
         if (details)
             std::cout << std::setw(WIDTH) << std::right << "" << "Sub-Relation Added" << r << std::endl;
+        ret.insert(std::move(r));
     }
-    for (const Dependency d : mc) {
-
-        unsigned int c = (count_if(ret.begin(), ret.end(),
-                [&] (const Relation & temp) {
-                    return isSubset(temp.attributes, d.getAttribs());
-                }));
+    for (const Dependency &d : mc) {
+        set_str attribs = d.getAttribs();
 
-        if (c < 1) {
+        if (!index.hasSuperset(attribs.begin(), attribs.end())) {
 
-            Relation r(("R" + std::to_string(++i)), d.getAttribs());
-            r.addDependencies(mc, false);
+            Relation r = cover.subRelation("R" + std::to_string(++i), attribs);
 
-            ret.insert(r);
+            index.insert(r.attributes.begin(), r.attributes.end());
             if (details) {
 
                 std::cout << std::setw(WIDTH) << std::right << "" << "Sub-Relation Added" << r << std::endl;
             }
+            ret.insert(std::move(r));
         }
 
     }
@@ -453,12 +745,12 @@ set_rel Relation::decomposePreserving(bool details) const {
  * decompose the relation into the sub-relations and returns the set of such relations.
  * All the decomposed sub relation will be in BCNF but it will not guarantees that
  * all the original dependencies are preserved from dependencies found in all 
- * sub-relations. It uses the private static method Relation::decompose to perform
+ * sub-relations. It uses the private method Relation::decompose to perform
  * the operation using recursive method.
  */
 set_rel Relation::decomposeNotPreserving(bool details)const {
     set_rel res;
-    Relation::decompose(res, *this, details);
+    decompose(res, name, attributes, details);
 
     return res;
 }
@@ -470,23 +762,37 @@ set_rel Relation::decomposeNotPreserving(bool details)const {
  * @return the set_str object containing all the attribute which are result of 
  * the closure operation.
  * @detaisl The method will find out all the possible attributes which can be derived 
- * by the parameter lhs using dependency set of the relation.
+ * by the parameter lhs using dependency set of the relation. The operation is
+ * performed on the attribute identifiers by the Analyzer of the relation.
  */
 set_str Relation::getClosure(const set_str &lhs) const {
-    set_str ret(lhs);
-    bool flag;
-    do {
-        flag = false;
-        for (const Dependency & d : this->dependencies) {
-            if (isSubset(ret, d.lhs)) {
-                unsigned int size = ret.size();
-                ret.insert(d.rhs.begin(), d.rhs.end());
-                if (size < ret.size())
-                    flag = true;
-            }
-        };
-    } while (flag);
-    return ret;
+    return getAnalyzer().getClosure(lhs);
+}
+
+/**
+ * 
+ * @param lhs represents the lhs attribute set of the dependency.
+ * @param rhs represents the rhs attribute set of the dependency.
+ * @return true if the rhs is subset of the closure of the lhs, false otherwise.
+ * @details Same as testing the rhs against Relation::getClosure, but the 
+ * closure is calculated only until all the attributes of the rhs are derived,
+ * so the test usually stops after few dependencies are applied.
+ */
+bool Relation::implies(const set_str &lhs, const set_str &rhs) const {
+    return getAnalyzer().implies(lhs, rhs);
+}
+
+/**
+ * 
+ * @param deps represents the dependencies to test.
+ * @return vector of boolean values, true if the dependency at the same position
+ * in the parameter deps is implied by the dependency set of the relation, false 
+ * otherwise.
+ * @details The dependencies are tested by Relation::implies, sharing the index
+ * of the dependency set and the working buffers among all the tests.
+ */
+std::vector<bool> Relation::impliesAll(const std::vector<Dependency> &deps) const {
+    return getAnalyzer().impliesAll(deps);
 }
 
 /**
@@ -495,10 +801,24 @@ set_str Relation::getClosure(const set_str &lhs) const {
  * @return set of dependency from dependencies of the relation object which violates 
  * the condition for the given normal form indicated by the parameter form. 
  * @details It uses the functor object of Violation as predicate to find out the
- * return value.
+ * return value. For the BCNF the lhs of all the dependencies are tested in one
+ * pass by the batch version of Relation::isSuperkey.
  */
 set_dep Relation::getViolation(const Relation::Normal &form) const {
     set_dep dep;
+    if (form == Relation::_BCNF) {
+        vector<set_str> lhs;
+        for (const Dependency &d : dependencies) {
+            lhs.push_back(d.getLhs());
+        }
+        vector<bool> superkey = isSuperkey(lhs);
+        unsigned int i = 0;
+        for (const Dependency &d : dependencies) {
+            if (!superkey[i++])
+                dep.insert(dep.end(), d);
+        }
+        return dep;
+    }
     Violation v(*this, form);
     itr_dep res = dependencies.begin();
     do {
@@ -518,6 +838,9 @@ set_dep Relation::getViolation(const Relation::Normal &form) const {
 void Relation::clearDependencies() {
 
     dependencies.clear();
+    lhsIndex.clear();
+    attributeIndex.clear();
+    invalidate();
 }
 
 /**
@@ -527,7 +850,10 @@ void Relation::clearDependencies() {
 void Relation::clearAttributes() {
 
     dependencies.clear();
+    lhsIndex.clear();
+    attributeIndex.clear();
     attributes.clear();
+    invalidate();
 }
 
 /**
@@ -558,150 +884,54 @@ void Relation::setAttributes(const set_str attributes) {
     this->addDependencies(temp, false);
 }
 
-/**
- * 
- * @param d Dependency on which the reduction of the lhs is to be performed.
- * @return true if the dependency lhs is reduced, otherwise false.
- * @details This method will use current dependency set of the relation to 
- * reduce the lhs attributes if possible.
- */
-bool Relation::processLHS(const Dependency &d) {
-    bool change;
-    unsigned int size = d.lhs.size();
-    set_str temp(d.lhs);
-    do {
-        //        std::cout << "Vector - " << temp << std::endl;
-        vector<string> v(temp.begin(), temp.end());
-        change = false;
-        if (temp.size() > 1) {
-            for (unsigned int i = 0; i < v.size(); ++i) {
-                //                std::cout << "Trying to remove - " << v[i] << std::endl;
-                //	      if (!(temp.size() > 1))
-                //      break;
-                itr_dep itrd = this->findDepLHS(temp);
-                temp.erase(v[i]);
-                set_str clr1 = getClosure(temp);
-                if (!clr1.empty() && isSubset(clr1, itrd->rhs)) {
-                    Dependency mod(temp, itrd->rhs);
-                    this->removeDependency(*itrd);
-                    this->addDependency(mod);
-                    //                    std::cout << "Removed. Dependency LHS - " << itrd->lhs << std::endl;
-                    change = true;
-                    break;
-                }
-                temp.insert(v[i]);
-            }
-        }
-    } while (change);
-
-    return (size != d.lhs.size());
-}
-
 /**
  * @param details a boolean parameter with default value false. If true the steps
  * involved in the finding minimal cover will be printed on standard output stream cout.
  * @return Returns the set of dependency representing the minimal form of current 
  * functional dependencies of the relation object.
- * @details The method will use three different steps reduce lhs, reduce rhs and
- * reduce rules by using private methods of the relation to get the minimal cover.
+ * @details The method will use three different steps reduce rhs, reduce lhs and
+ * reduce rules, performed in place by the CoverEngine on the identifier form of
+ * the dependencies, so no temporary relation is created. The closure used by 
+ * every step is linear in the size of the dependency set.
  */
 set_dep Relation::getMinimalCover(bool details) const {
-    set_dep min;
-    min = reduceRHS(this->dependencies);
+    CoverEngine cover(this->dependencies);
     if (details)
-        std::cout << std::setw(WIDTH) << std::right << "" << "Reduced RHS - " << min << std::endl;
-    min = reduceLHS(min);
+        std::cout << std::setw(WIDTH) << std::right << "" << "Reduced RHS - " << cover.getDependencies() << std::endl;
+    cover.reduceLHS();
     if (details)
-        std::cout << std::setw(WIDTH) << std::right << "" << "Reduced LHS - " << min << std::endl;
-    min = reduceRules(min);
+        std::cout << std::setw(WIDTH) << std::right << "" << "Reduced LHS - " << cover.getDependencies() << std::endl;
+    cover.reduceRules();
     if (details)
-        std::cout << std::setw(WIDTH) << std::right << "" << "Reduced Rules - " << min << std::endl;
-    Relation temp("a");
-    temp.addDependencies(min);
-    temp.reducedDependencies();
+        std::cout << std::setw(WIDTH) << std::right << "" << "Reduced Rules - " << cover.getDependencies() << std::endl;
 
-    return temp.dependencies;
+    return cover.getDependencies(true);
 }
 
 /**
  * 
- * @param dep represents the set of dependencies which should be converted into 
- * reduced RHS form.
- * @return dependency set representing the reduced RHS for parameter dep.
- * @details The dependency will be in the reduced RHS form if the rhs conrains 
- * only one attribute.
- */
-set_dep Relation::reduceRHS(const set_dep &dep) {
-    set_dep ret;
-    for (itr_dep i = dep.begin(); i != dep.end(); ++i) {
-        if (i->rhs.size() > 1) {
-            for_each(i->rhs.begin(), i->rhs.end(),
-                    [&] (const string & str) {
-                        ret.insert(Dependency(i->lhs, {
-                            str
-                        }));
-                    });
-        } else {
-
-            ret.insert(*i);
-        }
-    }
-    return ret;
-}
-
-/**
- * 
- * @param dep represents the set of dependencies which should be converted into 
- * reduced LHS form.
- * @return dependency set representing the reduced LHS form for parameter dep.
- * @details The dependency will be in the reduced LHS by identifying minimum set 
- * of LHS attribute which can preserve original dependency.
- */
-set_dep Relation::reduceLHS(const set_dep &dep) {
-    Relation temp("temp");
-    temp.setDependencies(dep);
-    for_each(dep.begin(), dep.end(),
-            [&] (const Dependency & d) {
-                if (d.lhs.size() > 1)
-                    temp.processLHS(d);
-            });
-
-    return reduceRHS(temp.dependencies);
-}
-
-/**
- * 
- * @param dep represents the set of dependencies which should be converted into 
- * reduced rules form.
- * @return dependency set representing the reduced rules form for parameter dep.
- * @details The dependency will be in the reduced LHS by removing the dependency
- * if it can be preserved by the other dependency in the dependency set.
+ * @param lhs represents the attribute set to find out is supekey or not.
+ * @return true if the parameter lhs is the superkey, false otherwise.
+ * @details The lhs is considered as the superkey if it is superset of at least
+ * one candidate key from candidate key set. It is tested by the closure of the 
+ * lhs, so the candidate keys are not calculated.
  */
-set_dep Relation::reduceRules(const set_dep &dep) {
-    Relation temp("temp");
-    temp.addDependencies(dep);
-    for (itr_dep i = dep.begin(); i != dep.end(); ++i) {
-        temp.removeDependency(*i);
-        //        std::cout << "Trying to remove " << *i << std::endl;
-        //        std::cout << i->lhs << "* = " << s << std::endl;
-        if (!(isSubset(temp.getClosure(i->lhs), i->rhs))) {
+bool Relation::isSuperkey(const set_str &lhs) const {
 
-            temp.addDependency(*i);
-        }
-    }
-    return temp.dependencies;
+    return getAnalyzer().isSuperkey(lhs);
 }
 
 /**
  * 
- * @param lhs represents the attribute set to find out is supekey or not.
- * @return true if the parameter lhs is the superkey, false otherwise.
- * @details The lhs is considered as the superkey if it is superset of at least
- * one candidate key from candidate key set.
+ * @param lhs represents the attribute sets to find out are supekey or not.
+ * @return vector of boolean values, true if the attribute set at the same 
+ * position in the parameter lhs is the superkey, false otherwise.
+ * @details The attribute set which is superset of another superkey from the 
+ * parameter is accepted without calculating its closure.
  */
-bool Relation::isSuperkey(const set_str &lhs) const {
+std::vector<bool> Relation::isSuperkey(const std::vector<set_str> &lhs) const {
 
-    return testSet(getCandidatekey(), lhs, true);
+    return getAnalyzer().isSuperkey(lhs);
 }
 
 /**
@@ -713,7 +943,7 @@ bool Relation::isSuperkey(const set_str &lhs) const {
  */
 bool Relation::isPartialkey(const set_str& lhs) const {
 
-    return testSet(getCandidatekey(), lhs) && !testSet(getCandidatekey(), lhs, true);
+    return getAnalyzer().isPartialkey(lhs);
 }
 
 /**
@@ -722,16 +952,26 @@ bool Relation::isPartialkey(const set_str& lhs) const {
  * @return true if the parameter str is the subset of prime attributes, false otherwise.
  * @details The attribute is considered as prime attribute if it belongs to any
  * one of the candidate key. If parameter is sub set of all the prime attribute
- * then true value is returned.
+ * then true value is returned, so the attributes of the parameter need not to
+ * belong to the same candidate key, as required by the test of the 3NF.
  */
 bool Relation::isPrime(const set_str& str) const {
-    set_key ck = getCandidatekey();
-    for (itr_key i = ck.begin(); i != ck.end(); ++i) {
-        if (isSubset(*i, str))
 
-            return true;
-    }
-    return false;
+    return getAnalyzer().isPrime(str);
+}
+
+/**
+ * 
+ * @return set_str object containing the attributes which belong to at least one
+ * candidate key of the relation.
+ * @details Every attribute is decided separately by a search for a key which 
+ * contains it, and the search stops at the first such key, so the remaining
+ * candidate keys are searched only if the targeted search fails. The keys 
+ * found are shared by the following attributes and retained for the following
+ * searches of the relation.
+ */
+set_str Relation::getPrimeAttributes(void) const {
+    return getAnalyzer().getPrimeAttributes();
 }
 
 
@@ -743,36 +983,56 @@ bool Relation::isPrime(const set_str& str) const {
  * @details The method will calculate all the possible candidate key for the 
  * relation object using current functional dependencies and the attributes. The
  * single key can be considered as set of attributes which can derive all the 
- * attributes of the relation uisng the dependency set of the relation.
+ * attributes of the relation uisng the dependency set of the relation. The search
+ * is performed on the attribute identifiers by the Analyzer of the relation.
  */
 set_key Relation::getCandidatekey(void) const {
-    set_str ss = attributes;
-    set_key working;
-    for (itr_str j = ss.begin(); j != ss.end(); ++j) {
-        for (itr_dep i = dependencies.begin(); i != dependencies.end(); ++i) {
-            if (i->isPresentRhs(*j)) {
-                ss.erase(*j);
-            }
-        }
-    }
-    ss = ss.empty() ? attributes : ss;
-    for_each(ss.begin(), ss.end(), [&] (const string & s) {
-        working.insert({s});
-    });
-    set_key keys;
-    do {
-        for_each(working.begin(), working.end(), [&] (const set_str & s) {
-            if (isSubset(getClosure(s), attributes) && !testSet(keys, s, true)) {
-                keys.insert(s);
-            }
-        });
+    return getAnalyzer().getCandidatekey();
+}
 
-        getNextIteration(working, attributes);
-        working -= keys;
-    } while (!working.empty());
+/**
+ * 
+ * @param options the KeySearchOptions object representing the limits of the 
+ * search.
+ * @return KeySearchResult object containing the candidate keys found within the
+ * limits, and whether the search is complete.
+ * @details The search stops when the time limit, the node budget or the number
+ * of the keys is reached, and the keys found until then are returned with the
+ * complete flag set to false, so the caller is not blocked on the relations 
+ * with a huge number of keys. The search follows the key engine of the
+ * relation, and with the size limit the level wise search is used, which does
+ * not examine the attribute sets with more attributes than the limit. The keys
+ * found are retained for the following searches of the relation.
+ */
+KeySearchResult Relation::getCandidatekey(const KeySearchOptions &options) const {
+    return getAnalyzer().getCandidatekey(options);
+}
 
-    return keys;
+/**
+ * 
+ * @return set_str object containing the attributes of a candidate key for the 
+ * relation.
+ * @details The key is found by removing the attributes one by one while the 
+ * remaining attributes are still a superkey, starting from the attributes which
+ * can be part of a key, so the candidate keys are not enumerated.
+ */
+set_str Relation::getAnyCandidateKey(void) const {
+    return getAnalyzer().getAnyCandidateKey();
+}
 
+/**
+ * 
+ * @return The KeyGenerator object which yields the candidate keys of the 
+ * relation.
+ * @details Unlike Relation::getCandidatekey, the keys are searched only when 
+ * they are retrieved from the generator, so the caller can stop after the first
+ * few keys. With the Relation::_LUCCHESI_OSBORN algorithm the keys are found 
+ * one at a time, the other algorithms find all the keys before the first key 
+ * is yielded.
+ */
+KeyGenerator Relation::keys(void) const {
+    getAnalyzer();
+    return KeyGenerator(analyzer);
 }
 
 /**
@@ -792,19 +1052,84 @@ bool Relation::isNormal(const Relation::Normal &form) const {
     return (res == dependencies.end());
 }
 
+/**
+ * 
+ * @param form is a Relation::Normal value represents the normal form for which 
+ * the relation is to be tested.
+ * @param options the KeySearchOptions object representing the limits of the 
+ * candidate key search. The limit of the key size is not considered, as all 
+ * the keys are required to find the prime attributes.
+ * @param complete a boolean parameter which is set to true if the result is 
+ * certain and to false if it could not be decided within the limits.
+ * @return true if the relation is in the normal form, false if it is not or if
+ * it could not be decided within the limits.
+ * @details The BCNF test does not require the candidate keys, so it is always 
+ * complete. For the 2NF and 3NF, if all the keys are found within the limits 
+ * the result is same as Relation::isNormal. Otherwise a dependency whose lhs is
+ * a superkey or whose rhs contains only the attributes of the keys found is 
+ * certainly not a violation, and if there is any other dependency the result
+ * is false with the complete flag set to false, instead of a possibly wrong 
+ * answer.
+ */
+bool Relation::isNormal(const Relation::Normal &form,
+        const KeySearchOptions &options, bool &complete) const {
+    complete = true;
+    if (form == Relation::_BCNF)
+        return isNormal(form);
+    KeySearchOptions all(options);
+    all.maxKeySize = 0;
+    KeySearchResult res = getCandidatekey(all);
+    if (res.complete)
+        return isNormal(form);
+    set_str primes;
+    for (const set_str &k : res.keys) {
+        primes.insert(k.begin(), k.end());
+    }
+    for (const Dependency &d : dependencies) {
+        if (!isSuperkey(d.getLhs()) && !isSubset(primes, d.getRhs())) {
+            complete = false;
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  * 
  * @param dep set of dependencies to be added into the relation.
  * @param update boolean parameter with default value false to indicate that
  * whether to add the attribute if dependency contains the attribute which is not
  * already present in the attribute set of the relation.
- * @details Foe every dependency object from the parameter dep, the method
- * Relation::addDependency will be called.
+ * @return The number of the dependencies from the parameter dep which are added.
+ * @details Every dependency object from the parameter dep is accepted same as
+ * by the method Relation::addDependency, and combined with the dependency of 
+ * the same lhs found by the hash index of the lhs, so the time is O(n log n) 
+ * for n dependencies. The Analyzer is discarded only once for all of them.
+ * Whenever a dependency is accepted, the dependency set is reduced by the
+ * method Relation::reducedDependencies, which combines the dependencies with
+ * the same lhs if there are any.
  */
 unsigned int Relation::addDependencies(const set_dep&dep, bool update) {
-    return count_if(dep.begin(), dep.end(), [&] (const Dependency & d) {
-        return (addDependency(d, update) != this->dependencies.end());
-    });
+    unsigned int count = 0;
+    for (const Dependency &i : dep) {
+        Dependency d(i);
+        if (!admitDependency(d, update))
+            continue;
+        ++count;
+        itr_dep j = findDepLHS(d.lhs);
+        if (j != dependencies.end()) {
+            if (isSubset(j->rhs, d.rhs))
+                continue;
+            d.rhs.insert(j->rhs.begin(), j->rhs.end());
+            eraseDependency(j);
+        }
+        insertDependency(std::move(d));
+    }
+    if (count) {
+        invalidate();
+        reducedDependencies();
+    }
+    return count;
 }
 
 /**
@@ -14,6 +14,10 @@
 
 #include "declaration.h"
 #include "dependency.h"
+#include "key_generator.h"
+#include "key_search.h"
+#include "dependency_index.h"
+#include "fd_table.h"
 
 #include <set>
 using std::set;
@@ -21,6 +25,10 @@ using std::set;
 #include <string>
 using std::string;
 
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
 /*!
  * \class Relation
  * \brief The Relation class that represents the relation entity.
@@ -53,18 +61,44 @@ public:
         _BCNF /*!< Represnts the Boyce-Codd Normal form*/
     };
 
+    /*!
+     * \enum KeyEngine
+     * \breif The enumeration to identify different algorithm for the candidate
+     * key calculation.
+     */
+    enum KeyEngine {
+        _LEVELWISE, /*!< Represnts the level wise search of the attribute sets*/
+        _LUCCHESI_OSBORN, /*!< Represnts the Lucchesi-Osborn key enumeration*/
+        _PARALLEL /*!< Represnts the level wise search on all the processors*/
+    };
+
 
     /*!
      * @breif The parameterized Relation constructor with default values for 
      * attribute set and dependencies set.
      */
-    Relation(const string &, const set_str &temp = *(new set_str()),
-            const set_dep &t2 = *(new set_dep()));
+    Relation(const string &, const set_str &temp = set_str(),
+            const set_dep &t2 = set_dep());
     /*!
      * @breif The copy constructor for the Relation class.
      */
     Relation(const Relation& orig);
 
+    /*!
+     * @breif The move constructor for the Relation class.
+     */
+    Relation(Relation&& orig);
+
+    /*!
+     * @breif The copy assignment operator for the Relation class.
+     */
+    Relation& operator=(const Relation& right);
+
+    /*!
+     * @breif The move assignment operator for the Relation class.
+     */
+    Relation& operator=(Relation&& right);
+
     /*!
      * @breif The destructor for the Relation class.
      */
@@ -119,6 +153,13 @@ public:
      */
     bool isNormal(const Relation::Normal&) const;
 
+    /*!
+     * @breif A method to test normal form of the current Relation object with
+     * the limited candidate key search.
+     */
+    bool isNormal(const Relation::Normal&, const KeySearchOptions &,
+            bool &complete) const;
+
     /*!
      * @breif A method to check if all the attributes of the parameter dependency 
      * present in the attribute set of the relation object.
@@ -131,6 +172,12 @@ public:
      */
     bool isSuperkey(const set_str &)const;
 
+    /*!
+     * @breif A method to test if the given string sets are the super-keys to 
+     * the relation.
+     */
+    std::vector<bool> isSuperkey(const std::vector<set_str> &)const;
+
     /*!
      * @breif A method to test if the given string set is the partial-key to the 
      * relation.
@@ -143,17 +190,51 @@ public:
      */
     bool isPrime(const set_str &)const;
 
+    /*!
+     * @breif A method to get the prime attribute set of the relation.
+     */
+    set_str getPrimeAttributes(void) const;
+
     /*!
      * @breif A method to get the closure of the given attribute set using 
      * functional dependency set of the Relation.
      */
     set_str getClosure(const set_str &) const;
 
+    /*!
+     * @breif A method to test if the dependency given by the lhs and the rhs 
+     * attribute sets is implied by the functional dependency set of the Relation.
+     */
+    bool implies(const set_str &, const set_str &) const;
+
+    /*!
+     * @breif A method to test if the given dependencies are implied by the 
+     * functional dependency set of the Relation.
+     */
+    std::vector<bool> impliesAll(const std::vector<Dependency> &) const;
+
     /*!
      * @breif A method to get all the candidate key set for the relation.
      */
     set_key getCandidatekey(void) const;
 
+    /*!
+     * @breif A method to get the candidate keys for the relation found within 
+     * the limits of the search.
+     */
+    KeySearchResult getCandidatekey(const KeySearchOptions &) const;
+
+    /*!
+     * @breif A method to get a single candidate key for the relation.
+     */
+    set_str getAnyCandidateKey(void) const;
+
+    /*!
+     * @breif A method to get the generator which yields the candidate keys one
+     * at a time.
+     */
+    KeyGenerator keys(void) const;
+
     /*!
      * @breif A method to get dependency set that violates given normal form 
      * conditions.
@@ -263,6 +344,38 @@ public:
      */
     itr_dep addDependency(const Dependency &, bool update = true);
 
+    /*!
+     * @breif A getter method to retrieve the algorithm used for the candidate 
+     * key calculation.
+     * @return The Relation::KeyEngine value of the relation.
+     */
+    KeyEngine getKeyEngine() const {
+        return engine;
+    }
+
+    /*!
+     * @breif A setter method to select the algorithm used for the candidate key
+     * calculation.
+     */
+    void setKeyEngine(const KeyEngine);
+
+    /*!
+     * @breif A method to retrieve the number of the closures found in the 
+     * closure cache of the relation.
+     * @details The counts of the closure cache belong to the object. A copy 
+     * starts with zero counts and the copy assignment keeps the counts of the
+     * assigned object, while the move constructor and the move assignment take
+     * the counts of the moved relation, replacing the counts of the assigned
+     * object, and reset the counts of the moved relation to zero.
+     */
+    unsigned long getClosureHits() const;
+
+    /*!
+     * @breif A method to retrieve the number of the closures calculated because 
+     * they are not found in the closure cache of the relation.
+     */
+    unsigned long getClosureMisses() const;
+
 
 
 private:
@@ -270,40 +383,65 @@ private:
     string name; /*!< string data member represents the name of the relation*/
     set_str attributes; /*!< set_str object represents the attribute set of the relation*/
     set_dep dependencies; /*!< set_dep object represents the dependency set of the relation*/
+    std::unordered_map<set_str, itr_dep, setstr_hash> lhsIndex; /*!< The
+                                      * position of the dependency for every lhs
+                                      * of the dependency set*/
+    mutable DependencyIndex attributeIndex; /*!< The dependencies containing 
+                                             * every attribute*/
+    mutable std::shared_ptr<const FDTable> table; /*!< The structure of arrays
+                                                   * form of the dependency set
+                                                   * read by the Analyzer and
+                                                   * the projections*/
+    KeyEngine engine; /*!< The algorithm used for the candidate key calculation*/
+    mutable std::shared_ptr<const Analyzer> analyzer; /*!< The identifier form of
+                                                       * the relation used by the 
+                                                       * analysis methods*/
+    unsigned long closureHits; /*!< The number of the cache hits of the 
+                                * discarded Analyzer objects*/
+    unsigned long closureMisses; /*!< The number of the cache misses of the 
+                                  * discarded Analyzer objects*/
 
+    /*!
+     * @breif A recursive method of the relation to decompose the projection of
+     * the relation into the BCNF form using the non FD preserving algorithm.
+     */
+    void decompose(set_rel &rset, const string &, const set_str &,
+            bool details = false) const;
 
     /*!
-     * @breif A recursive static method of the relation to decompose the parameter 
-     * relation object into the BCNF form using the non FD preserving algorithm.
+     * @breif A method to construct the projection of the relation on the given
+     * attribute set as a new relation.
      */
-    static void decompose(set_rel &rset, const Relation &r, bool details = false);
+    Relation subRelation(const string &, const set_str &) const;
 
     /*!
-     * @breif A static method to get next possible iteration set for calculating 
-     * the candidate key using existing key and the attribute set parameter.
+     * @breif A method to retrieve the Analyzer for the current state of the 
+     * relation.
      */
-    static void getNextIteration(set_key& key, const set_str& attributes);
+    const Analyzer& getAnalyzer(void) const;
 
     /*!
-     * @breif A static method to reduce the RHS of all the parameter dependencies.
+     * @breif A method to discard the Analyzer when the relation is modified.
      */
-    static set_dep reduceRHS(const set_dep &);
+    void invalidate(void);
 
     /*!
-     * @breif A static method to reduce the LHS of all the parameter dependencies.
+     * @breif A method to retrieve the index of the dependencies containing 
+     * every attribute for the current state of the relation.
      */
-    static set_dep reduceLHS(const set_dep &);
+    const DependencyIndex& getAttributeIndex(void) const;
 
     /*!
-     * @breif A static method to reduce the rules of all the parameter dependencies.
+     * @brief A method to retrieve the FDTable for the current state of the
+     * relation.
      */
-    static set_dep reduceRules(const set_dep &);
+    const std::shared_ptr<const FDTable>& getTable(void) const;
 
     /*!
-     * @breif A predicate method used to process the LHS to find its the reduced 
-     * form for a dependency. 
+     * @breif A method to get the dependencies of the relation projected on the
+     * given attribute set.
      */
-    bool processLHS(const Dependency &);
+    set_dep project(const set_str &) const;
 
     /*!
      * @breif A method to combine the dependencies from the dependency set of the 
@@ -311,6 +449,29 @@ private:
      */
     void reducedDependencies(void);
 
+    /*!
+     * @breif A method to check whether the dependency can be added to the 
+     * relation, adding or removing its attributes as required.
+     */
+    bool admitDependency(Dependency &, bool update);
+
+    /*!
+     * @breif A method to remove the dependency at the given position from the 
+     * dependency set and from the index of the lhs.
+     */
+    itr_dep eraseDependency(itr_dep);
+
+    /*!
+     * @breif A method to insert the dependency into the dependency set, the 
+     * index of the lhs and the index of the attributes.
+     */
+    itr_dep insertDependency(Dependency &&);
+
+    /*!
+     * @breif A method to rebuild the index of the lhs from the dependency set.
+     */
+    void indexDependencies(void);
+
     /*!
      * @breif A setter method to set the new dependency set for the relation.
      */
@@ -0,0 +1,181 @@
+/*! \file set_trie.h
+ *
+ * \brief Includes declaration and definition for the class template SetTrie
+ * and its members.
+ *
+ * \details
+ * This file declares the definition of the class template SetTrie along with
+ * its subsequent data members and member functions.
+ *
+ */
+#ifndef SET_TRIE_H
+#define SET_TRIE_H
+
+#include <map>
+#include <vector>
+
+/*!
+ * \class SetTrie
+ * \brief The SetTrie class template is an index of sets which answers the
+ * subset and the superset queries.
+ * \details Every stored set is a path from the root of the trie, with the
+ * elements in the increasing order. The sets sharing a prefix share the nodes,
+ * so a query visits only the nodes whose path can be a subset or a superset of
+ * the queried set, instead of testing every stored set. The template parameter
+ * T is the type of the elements, which must be ordered by the operator <. The
+ * elements are passed as a range in the increasing order without duplicates,
+ * like the range of a set_str object or of a std::vector sorted by the caller.
+ */
+template <class T>
+class SetTrie {
+public:
+
+    /**
+     * @brief Constructs the empty index.
+     */
+    SetTrie() : nodes(1), count(0) {
+    }
+
+    /**
+     * @brief A method to add a set to the index.
+     * @param first the iterator to the smallest element of the set.
+     * @param last the iterator past the largest element of the set.
+     * @return true if the set is added, false if it is already present.
+     */
+    template <class Iterator>
+    bool insert(Iterator first, Iterator last) {
+        unsigned int n = 0;
+        for (; first != last; ++first) {
+            typename std::map<T, unsigned int>::iterator c =
+                    nodes[n].children.find(*first);
+            if (c == nodes[n].children.end()) {
+                nodes[n].children.insert(std::make_pair(*first, nodes.size()));
+                n = nodes.size();
+                nodes.push_back(Node());
+            } else {
+                n = c->second;
+            }
+        }
+        if (nodes[n].terminal)
+            return false;
+        nodes[n].terminal = true;
+        ++count;
+        return true;
+    }
+
+    /**
+     * @brief A method to check whether any stored set is subset of the given set.
+     * @param first the iterator to the smallest element of the set.
+     * @param last the iterator past the largest element of the set.
+     * @return true if at least one stored set is subset of the set, false
+     * otherwise.
+     */
+    template <class Iterator>
+    bool hasSubset(Iterator first, Iterator last) const {
+        std::vector<T> x(first, last);
+        return count && subset(0, x, 0);
+    }
+
+    /**
+     * @brief A method to check whether any stored set is superset of the given
+     * set.
+     * @param first the iterator to the smallest element of the set.
+     * @param last the iterator past the largest element of the set.
+     * @return true if at least one stored set is superset of the set, false
+     * otherwise.
+     */
+    template <class Iterator>
+    bool hasSuperset(Iterator first, Iterator last) const {
+        std::vector<T> x(first, last);
+        return count && superset(0, x, 0);
+    }
+
+    /**
+     * @brief A method to retrieve the number of the stored sets.
+     * @return The number of the sets in the index.
+     */
+    unsigned int size(void) const {
+        return count;
+    }
+
+    /**
+     * @brief A method to check whether the index is empty.
+     * @return true if no set is stored, false otherwise.
+     */
+    bool empty(void) const {
+        return !count;
+    }
+
+    /**
+     * @brief A method to remove all the sets from the index.
+     */
+    void clear(void) {
+        nodes.assign(1, Node());
+        count = 0;
+    }
+
+private:
+
+    /*!
+     * \struct Node
+     * \brief A single node of the trie.
+     */
+    struct Node {
+        std::map<T, unsigned int> children; /*!< The index of the child node
+                                             * for every next element*/
+        bool terminal; /*!< Indicates whether a set ends at the node*/
+
+        Node() : terminal(false) {
+        }
+    };
+
+    std::vector<Node> nodes; /*!< The nodes of the trie, the root is first*/
+    unsigned int count; /*!< The number of the stored sets*/
+
+    /**
+     * @brief Searches a stored set which is subset of the queried set.
+     * @param n the index of the current node.
+     * @param x the elements of the queried set.
+     * @param i the index of the first element of x which is not yet matched.
+     * @return true if a set ending in the subtree of the node is subset of the
+     * queried set, false otherwise.
+     * @details Only the children for the remaining elements of x are visited.
+     */
+    bool subset(unsigned int n, const std::vector<T> &x, unsigned int i) const {
+        if (nodes[n].terminal)
+            return true;
+        const std::map<T, unsigned int> &children = nodes[n].children;
+        for (; i < x.size(); ++i) {
+            typename std::map<T, unsigned int>::const_iterator c =
+                    children.find(x[i]);
+            if (c != children.end() && subset(c->second, x, i + 1))
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Searches a stored set which is superset of the queried set.
+     * @param n the index of the current node.
+     * @param x the elements of the queried set.
+     * @param i the index of the first element of x which is not yet matched.
+     * @return true if a set ending in the subtree of the node is superset of
+     * the queried set, false otherwise.
+     * @details Every node is on the path of a stored set, so the search succeeds
+     * when all the elements are matched. Only the children not greater than the
+     * next element of x are visited, as a greater child can not lead to it.
+     */
+    bool superset(unsigned int n, const std::vector<T> &x, unsigned int i) const {
+        if (i == x.size())
+            return true;
+        const std::map<T, unsigned int> &children = nodes[n].children;
+        for (typename std::map<T, unsigned int>::const_iterator c =
+                children.begin(); c != children.end() && !(x[i] < c->first); ++c) {
+            if (superset(c->second, x, c->first < x[i] ? i : i + 1))
+                return true;
+        }
+        return false;
+    }
+};
+
+#endif /* SET_TRIE_H */
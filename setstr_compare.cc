@@ -13,6 +13,8 @@
 
 #include "declaration.h"
 
+#include <functional>
+
 /**
  * compares both objects of the sets of the string based on the size of set and
  * if equal then contents of the string set.
@@ -38,3 +40,23 @@ bool setstr_compare::less(const set_str &lhs, const set_str &rhs) {
 bool setstr_compare::operator()(const set_str &lhs, const set_str &rhs) const {
     return setstr_compare::less(lhs, rhs);
 }
+
+/**
+ * The hash values of the strings are combined in the order of the set, so the
+ * equal sets have the equal hash value.
+ */
+std::size_t setstr_hash::hash(const set_str &str) {
+    std::size_t ret = str.size();
+    std::hash<string> h;
+    for (const string &s : str) {
+        ret ^= h(s) + 0x9e3779b9 + (ret << 6) + (ret >> 2);
+    }
+    return ret;
+}
+
+/**
+ * Just calls the hash function to determine the hash value of the parameter.
+ */
+std::size_t setstr_hash::operator()(const set_str &str) const {
+    return setstr_hash::hash(str);
+}
@@ -0,0 +1,163 @@
+/*! \file task_scheduler.cc
+ *
+ * \brief Includes definitions of the TaskScheduler class members defined in the
+ * task_scheduler.h file
+ *
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * TaskScheduler.
+ *
+ */
+#include "task_scheduler.h"
+
+/*!
+  \def CHUNKS
+  Defines the number of the chunks created for every thread, so that a thread
+  which finishes early has chunks to steal.
+ */
+#define CHUNKS 8
+
+/**
+ *
+ * @param threads the number of the threads. Default value is zero, in which
+ * case the number of the hardware threads is used.
+ * @details The calling thread of TaskScheduler::run takes part in every run,
+ * so one thread less is created, and none for a single thread.
+ */
+TaskScheduler::TaskScheduler(unsigned int threads) :
+threads(threads ? threads : std::thread::hardware_concurrency()),
+queues(this->threads ? this->threads : 1), locks(queues.size()),
+task(nullptr), generation(0), pending(0), stop(false) {
+    if (!this->threads)
+        this->threads = 1;
+    for (unsigned int t = 1; t < this->threads; ++t) {
+        workers.push_back(std::thread(&TaskScheduler::wait, this, t));
+    }
+}
+
+/**
+ * @details The threads finish the current run, if any, before they exit.
+ */
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stop = true;
+    }
+    wake.notify_all();
+    for (std::thread &t : workers) {
+        t.join();
+    }
+}
+
+/**
+ *
+ * @param count the number of the tasks, the task is called for every index
+ * from zero to count - 1.
+ * @param task the function to be called with the index of the task.
+ * @details The method returns when all the tasks are finished. The threads are
+ * not woken up if there is only one thread or one task. No new chunk is added
+ * while the tasks are executed, so a thread finishes when all the queues are
+ * empty. A run started by another thread is finished before the chunks of this
+ * run are queued.
+ */
+void TaskScheduler::run(unsigned int count,
+        const std::function<void(unsigned int)> &task) {
+    unsigned int n = threads < count ? threads : count;
+    if (n <= 1) {
+        for (unsigned int i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+    std::lock_guard<std::mutex> serial(running);
+    unsigned int size = (count + n * CHUNKS - 1) / (n * CHUNKS);
+    for (unsigned int b = 0, q = 0; b < count; b += size, q = (q + 1) % n) {
+        queues[q].push_back(chunk(b, b + size < count ? b + size : count));
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        this->task = &task;
+        pending = workers.size();
+        ++generation;
+    }
+    wake.notify_all();
+    work(0);
+    std::unique_lock<std::mutex> guard(lock);
+    done.wait(guard, [this] {
+        return pending == 0;
+    });
+    this->task = nullptr;
+}
+
+/**
+ *
+ * @return The reference of the scheduler with the number of the hardware
+ * threads.
+ * @details The scheduler is created on the first call and destroyed at the
+ * exit of the process, so the threads are created once for all the analyses.
+ */
+TaskScheduler& TaskScheduler::getShared(void) {
+    static TaskScheduler shared;
+    return shared;
+}
+
+/**
+ *
+ * @param self the index of the thread.
+ * @details The loop of a thread of the pool, which waits for a new run and
+ * takes part in it until the scheduler is destroyed.
+ */
+void TaskScheduler::wait(unsigned int self) {
+    unsigned int seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [&] {
+                return stop || generation != seen;
+            });
+            if (stop)
+                return;
+            seen = generation;
+        }
+        work(self);
+        std::lock_guard<std::mutex> guard(lock);
+        if (--pending == 0)
+            done.notify_one();
+    }
+}
+
+/**
+ *
+ * @param self the index of the thread.
+ * @details The thread processes the chunks from the back of its own queue,
+ * and then steals the chunks from the front of the queues of the other
+ * threads until all the queues are empty.
+ */
+void TaskScheduler::work(unsigned int self) {
+    unsigned int n = queues.size();
+    for (;;) {
+        chunk c;
+        bool found = false;
+        for (unsigned int k = 0; k < n && !found; ++k) {
+            unsigned int q = (self + k) % n;
+            std::lock_guard<std::mutex> guard(locks[q]);
+            if (!queues[q].empty()) {
+                if (q == self) {
+                    c = queues[q].back();
+                    queues[q].pop_back();
+                } else {
+                    c = queues[q].front();
+                    queues[q].pop_front();
+                }
+                found = true;
+            }
+        }
+        if (!found)
+            return;
+        for (unsigned int i = c.first; i < c.second; ++i) {
+            (*task)(i);
+        }
+    }
+}
+
+#undef CHUNKS
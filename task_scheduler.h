@@ -0,0 +1,106 @@
+/*! \file task_scheduler.h
+ *
+ * \brief Includes declaration for the class TaskScheduler and its members.
+ *
+ * \details
+ * This file declares the definition of the class TaskScheduler along with its
+ * subsequent data members and the member functions prototype.
+ *
+ */
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*!
+ * \class TaskScheduler
+ * \brief The TaskScheduler class runs a range of independent tasks on a
+ * number of threads with the work stealing.
+ * \details The range of the task indices is divided into chunks which are
+ * distributed evenly among the queues of the threads. Every thread processes
+ * the chunks from the back of its own queue, and when its queue is empty it
+ * steals the chunks from the front of the queues of the other threads, so the
+ * threads which receive the cheap tasks help the others until all the tasks
+ * are finished. The tasks must not depend on each other, and the result of a
+ * task should be stored at its index, so the result does not depend on the
+ * order in which the tasks are executed. The threads are created once by the
+ * constructor and wait for the next range between the runs, so a scheduler
+ * which is used for many small ranges does not pay for creating the threads
+ * on every run. A scheduler runs one range at a time, the concurrent calls of
+ * TaskScheduler::run wait for each other, and it must not be used from within
+ * its own tasks. The scheduler returned by TaskScheduler::getShared is shared
+ * by all the analyses of the process.
+ */
+class TaskScheduler {
+public:
+
+    /**
+     * @brief Constructs the scheduler with the given number of threads.
+     */
+    explicit TaskScheduler(unsigned int threads = 0);
+
+    /**
+     * @brief Stops and joins the threads of the scheduler.
+     */
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+    /**
+     * @brief A method to execute the task for every index of the range.
+     */
+    void run(unsigned int count, const std::function<void(unsigned int)> &);
+
+    /**
+     * @brief A method to get the scheduler shared by the process.
+     */
+    static TaskScheduler& getShared(void);
+
+    /**
+     * @brief A getter method to retrieve the number of the threads.
+     * @return The number of the threads used to execute the tasks.
+     */
+    unsigned int getThreads(void) const {
+        return threads;
+    }
+
+private:
+    /*!
+     * \typedef std::pair<unsigned int, unsigned int> chunk
+     * \brief The range of the task indices, from the first index to the index
+     * past the last one, which is queued and stolen as a unit.
+     */
+    typedef std::pair<unsigned int, unsigned int> chunk;
+
+    /**
+     * @brief The loop of a thread of the pool waiting for the runs.
+     */
+    void wait(unsigned int self);
+
+    /**
+     * @brief A method to execute the queued chunks of the current run.
+     */
+    void work(unsigned int self);
+
+    unsigned int threads; /*!< The number of the threads*/
+    std::vector<std::deque<chunk> > queues; /*!< Chunks queued for every thread*/
+    std::vector<std::mutex> locks; /*!< Lock guarding every queue*/
+    const std::function<void(unsigned int)> *task; /*!< Task of the current run*/
+    unsigned int generation; /*!< Number of the runs handed to the threads*/
+    unsigned int pending; /*!< Threads still working on the current run*/
+    bool stop; /*!< Set when the threads have to exit*/
+    std::mutex running; /*!< Lock serializing the runs*/
+    std::mutex lock; /*!< Lock guarding the run state*/
+    std::condition_variable wake; /*!< Signals a new run or the stop*/
+    std::condition_variable done; /*!< Signals the end of the current run*/
+    std::vector<std::thread> workers; /*!< Threads other than the caller*/
+};
+
+#endif /* TASK_SCHEDULER_H */
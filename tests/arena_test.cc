@@ -0,0 +1,79 @@
+/*! \file arena_test.cc
+ * 
+ * \brief Includes definitions of the arena_test class members defined in the 
+ * arena_test.h file
+ *  
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * arena_test.
+ * 
+ */
+#include "arena_test.h"
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(arena_test);
+
+arena_test::arena_test() {
+}
+
+arena_test::~arena_test() {
+}
+
+void arena_test::setUp() {
+    arena = new Arena(256);
+}
+
+void arena_test::tearDown() {
+    delete arena;
+}
+
+void arena_test::testAllocate() {
+    char *a = static_cast<char*> (arena->allocate(3, 1));
+    void *b = arena->allocate(sizeof (double), alignof(double));
+    char *c = static_cast<char*> (arena->allocate(1, 1));
+    CPPUNIT_ASSERT_MESSAGE("failed to allocate from the block",
+            reinterpret_cast<std::uintptr_t> (b) % alignof(double) == 0
+            && static_cast<char*> (b) >= a + 3
+            && c == static_cast<char*> (b) + sizeof (double)
+            && arena->getBlocks() == 1
+            && arena->getAllocated() == 4 + sizeof (double));
+}
+
+void arena_test::testAllocate2() {
+    arena->allocate(200, 1);
+    arena->allocate(100, 1);
+    arena->allocate(2000, 1);
+    CPPUNIT_ASSERT_MESSAGE("failed to allocate the new blocks",
+            arena->getBlocks() == 3 && arena->getAllocated() == 2300);
+}
+
+void arena_test::testRelease() {
+    arena->allocate(1000, 1);
+    arena->release();
+    bool released = arena->getBlocks() == 0 && arena->getAllocated() == 0;
+    arena->allocate(10, 1);
+    CPPUNIT_ASSERT_MESSAGE("failed to release the blocks",
+            released && arena->getBlocks() == 1);
+}
+
+void arena_test::testAllocator() {
+    typedef std::set<std::string, std::less<std::string>,
+            ArenaAllocator<std::string> > set_arena;
+    ArenaAllocator<std::string> alloc(*arena);
+    set_arena s(std::less<std::string>(), alloc);
+    for (int i = 0; i < 100; ++i) {
+        s.insert(std::to_string(i % 50));
+    }
+    set_arena t(std::less<std::string>(), alloc);
+    t.swap(s);
+    ArenaAllocator<int> other(alloc);
+    Arena a;
+    CPPUNIT_ASSERT_MESSAGE("failed to allocate the nodes from the arena",
+            t.size() == 50 && s.empty() && *t.begin() == "0"
+            && arena->getAllocated() > 0 && other == alloc
+            && other != ArenaAllocator<int>(a));
+}
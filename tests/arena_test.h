@@ -0,0 +1,43 @@
+/*! @file arena_test.h
+ * 
+ * @brief Includes declaration for the class arena_test and its members.
+ *  
+ * @details
+ * This file declares the definition of the class arena_test along with its 
+ * subsequent data members and the member functions prototype. This class is 
+ * designed to test the methods from the Arena class and the ArenaAllocator 
+ * class template.
+ * 
+ */
+#ifndef ARENA_TEST_H
+#define ARENA_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../arena.h"
+
+class arena_test : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(arena_test);
+
+    CPPUNIT_TEST(testAllocate);
+    CPPUNIT_TEST(testAllocate2);
+    CPPUNIT_TEST(testRelease);
+    CPPUNIT_TEST(testAllocator);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    arena_test();
+    virtual ~arena_test();
+    void setUp();
+    void tearDown();
+
+private:
+    Arena *arena;
+    void testAllocate();
+    void testAllocate2();
+    void testRelease();
+    void testAllocator();
+
+};
+
+#endif /* ARENA_TEST_H */
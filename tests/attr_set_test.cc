@@ -0,0 +1,182 @@
+/*! \file attr_set_test.cc
+ * 
+ * \brief Includes definitions of the attr_set_test class members defined in the 
+ * attr_set_test.h file
+ *  
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * attr_set_test.
+ * 
+ */
+#include "attr_set_test.h"
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(attr_set_test);
+
+attr_set_test::attr_set_test() {
+}
+
+attr_set_test::~attr_set_test() {
+}
+
+void attr_set_test::setUp() {
+    lhs = new AttrSet(8);
+    rhs = new AttrSet();
+    lhs->insert(1);
+    lhs->insert(3);
+    lhs->insert(70);
+    lhs->insert(130);
+    rhs->insert(3);
+    rhs->insert(130);
+}
+
+void attr_set_test::tearDown() {
+    delete lhs;
+    delete rhs;
+}
+
+void attr_set_test::testInsert() {
+    CPPUNIT_ASSERT_MESSAGE("insert new identifier failed",
+            lhs->insert(200) && lhs->contains(200) && !lhs->contains(199));
+    CPPUNIT_ASSERT_MESSAGE("insert existing identifier failed",
+            !lhs->insert(70) && contains(*lhs, 70));
+}
+
+void attr_set_test::testErase() {
+    CPPUNIT_ASSERT_MESSAGE("erase existing identifier failed",
+            lhs->erase(70) && !lhs->contains(70));
+    CPPUNIT_ASSERT_MESSAGE("erase non-existing identifier failed",
+            !lhs->erase(70) && !lhs->erase(1000));
+}
+
+void attr_set_test::testSize() {
+    AttrSet empty(300);
+    CPPUNIT_ASSERT_MESSAGE("size failed", lhs->size() == 4 && rhs->size() == 2);
+    CPPUNIT_ASSERT_MESSAGE("empty failed", !lhs->empty() && empty.empty());
+}
+
+void attr_set_test::testNext() {
+    CPPUNIT_ASSERT_MESSAGE("iteration over identifiers failed",
+            lhs->first() == 1 && lhs->next(2) == 3 && lhs->next(4) == 70
+            && lhs->next(71) == 130 && lhs->next(131) == AttrSet::npos
+            && AttrSet().first() == AttrSet::npos);
+}
+
+void attr_set_test::testIsSubset() {
+    CPPUNIT_ASSERT_MESSAGE("subset test failed",
+            isSubset(*lhs, *rhs) && !isSubset(*rhs, *lhs)
+            && isSubset(*rhs, AttrSet(500)));
+}
+
+void attr_set_test::testIntersects() {
+    AttrSet s;
+    s.insert(2);
+    CPPUNIT_ASSERT_MESSAGE("intersection test failed",
+            lhs->intersects(*rhs) && !lhs->intersects(s));
+}
+
+void attr_set_test::testOperatorOrEq() {
+    AttrSet s;
+    s.insert(500);
+    s |= *lhs;
+    CPPUNIT_ASSERT_MESSAGE("union failed",
+            s.size() == 5 && isSubset(s, *lhs) && s.contains(500));
+}
+
+void attr_set_test::testOperatorAndEq() {
+    *lhs &= *rhs;
+    CPPUNIT_ASSERT_MESSAGE("intersection failed", isEqual(*lhs, *rhs));
+}
+
+void attr_set_test::testOperatorSubEq() {
+    *lhs -= *rhs;
+    CPPUNIT_ASSERT_MESSAGE("difference failed",
+            lhs->size() == 2 && lhs->contains(1) && lhs->contains(70)
+            && !lhs->intersects(*rhs));
+}
+
+void attr_set_test::testOperatorEq() {
+    AttrSet s(1000);
+    s.insert(3);
+    s.insert(130);
+    CPPUNIT_ASSERT_MESSAGE("equality failed",
+            s == *rhs && *lhs != *rhs && AttrSet(64) == AttrSet());
+}
+
+void attr_set_test::testOperatorLess() {
+    AttrSet a, b;
+    a.insert(1);
+    a.insert(5);
+    b.insert(2);
+    b.insert(3);
+    CPPUNIT_ASSERT_MESSAGE("less comparison failed",
+            *rhs < *lhs && !(*lhs < *rhs) && a < b && !(b < a) && !(a < a));
+}
+
+void attr_set_test::testFixedAttrSet() {
+    FixedAttrSet<64> a, b;
+    a.insert(0);
+    a.insert(5);
+    a.insert(63);
+    b.insert(5);
+    CPPUNIT_ASSERT_MESSAGE("single word fixed set failed",
+            a.size() == 3 && isSubset(a, b) && !isSubset(b, a)
+            && a.next(6) == 63 && a.next(64) == FixedAttrSet<64>::npos
+            && !b.insert(5) && b < a);
+    a -= b;
+    CPPUNIT_ASSERT_MESSAGE("fixed set difference failed",
+            !a.intersects(b) && a.size() == 2 && contains(a, 63));
+}
+
+void attr_set_test::testFixedAttrSet2() {
+    FixedAttrSet<256> a, b;
+    a.insert(3);
+    a.insert(200);
+    b.insert(130);
+    b |= a;
+    CPPUNIT_ASSERT_MESSAGE("multi word fixed set failed",
+            b.size() == 3 && isSubset(b, a) && b.next(4) == 130
+            && b.next(131) == 200 && !b.contains(256));
+    b &= a;
+    CPPUNIT_ASSERT_MESSAGE("fixed set intersection failed",
+            isEqual(a, b) && b.erase(200) && !b.erase(200) && a != b);
+}
+
+void attr_set_test::testKernel() {
+    const AttrKernel &k = AttrKernel::get(), &sc = AttrKernel::scalar();
+    AttrKernel::word a[19], b[19], c[19], d[19];
+    for (unsigned int i = 0; i < 19; ++i) {
+        a[i] = 0x9E3779B97F4A7C15ULL * (i + 1);
+        b[i] = a[i] & (0xF0F0F0F0F0F0F0F0ULL >> (i % 4));
+    }
+    CPPUNIT_ASSERT_MESSAGE("kernel subset and equality test failed",
+            k.includes(a, b, 19) && !k.includes(b, a, 19)
+            && k.includes(a, b, 19) == sc.includes(a, b, 19)
+            && k.equal(a, a, 19) && !k.equal(a, b, 19)
+            && k.count(a, 19) == sc.count(a, 19));
+    for (unsigned int i = 0; i < 19; ++i) {
+        c[i] = d[i] = ~b[i];
+    }
+    k.unite(c, b, 19);
+    sc.subtract(d, a, 19);
+    CPPUNIT_ASSERT_MESSAGE("kernel union failed",
+            k.count(c, 19) == 19 * 64 && sc.count(c, 19) == 19 * 64);
+    k.subtract(c, a, 19);
+    CPPUNIT_ASSERT_MESSAGE("kernel and-not failed",
+            !k.equal(c, b, 19) && k.equal(c, d, 17) && k.equal(c, d, 19));
+}
+
+void attr_set_test::testKernelCovered() {
+    const AttrKernel &k = AttrKernel::get();
+    AttrKernel::word x[5] = {0xFF, 0, 0xF0, 0, 1};
+    AttrKernel::word rows[15] = {
+        0x100, 0, 0, 0, 0,
+        0x0F, 0, 0x10, 0, 1,
+        0x01, 0, 0, 0, 0
+    };
+    CPPUNIT_ASSERT_MESSAGE("kernel covered rows failed",
+            k.covered(x, rows, 5, 3) == 1
+            && k.covered(x, rows, 5, 1) == 1
+            && AttrKernel::scalar().covered(x, rows, 5, 3) == 1);
+}
+
@@ -0,0 +1,67 @@
+/*! @file attr_set_test.h
+ * 
+ * @brief Includes declaration for the class attr_set_test and its members.
+ *  
+ * @details
+ * This file declares the definition of the class attr_set_test along with its 
+ * subsequent data members and the member functions prototype. This class is 
+ * designed to test the methods from the AttrSet class.
+ * 
+ */
+#ifndef ATTR_SET_TEST_H
+#define ATTR_SET_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../attr_set.h"
+#include "../fixed_attr_set.h"
+#include "../attr_kernel.h"
+
+class attr_set_test : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(attr_set_test);
+
+    CPPUNIT_TEST(testInsert);
+    CPPUNIT_TEST(testErase);
+    CPPUNIT_TEST(testSize);
+    CPPUNIT_TEST(testNext);
+    CPPUNIT_TEST(testIsSubset);
+    CPPUNIT_TEST(testIntersects);
+    CPPUNIT_TEST(testOperatorOrEq);
+    CPPUNIT_TEST(testOperatorAndEq);
+    CPPUNIT_TEST(testOperatorSubEq);
+    CPPUNIT_TEST(testOperatorEq);
+    CPPUNIT_TEST(testOperatorLess);
+    CPPUNIT_TEST(testFixedAttrSet);
+    CPPUNIT_TEST(testFixedAttrSet2);
+    CPPUNIT_TEST(testKernel);
+    CPPUNIT_TEST(testKernelCovered);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    attr_set_test();
+    virtual ~attr_set_test();
+    void setUp();
+    void tearDown();
+
+private:
+    AttrSet *lhs, *rhs;
+    void testInsert();
+    void testErase();
+    void testSize();
+    void testNext();
+    void testIsSubset();
+    void testIntersects();
+    void testOperatorOrEq();
+    void testOperatorAndEq();
+    void testOperatorSubEq();
+    void testOperatorEq();
+    void testOperatorLess();
+    void testFixedAttrSet();
+    void testFixedAttrSet2();
+    void testKernel();
+    void testKernelCovered();
+
+};
+
+#endif /* ATTR_SET_TEST_H */
+
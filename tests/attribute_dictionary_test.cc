@@ -0,0 +1,57 @@
+/*! \file attribute_dictionary_test.cc
+ * 
+ * \brief Includes definitions of the attribute_dictionary_test class members 
+ * defined in the attribute_dictionary_test.h file
+ *  
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * attribute_dictionary_test.
+ * 
+ */
+#include "attribute_dictionary_test.h"
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(attribute_dictionary_test);
+
+attribute_dictionary_test::attribute_dictionary_test() {
+}
+
+attribute_dictionary_test::~attribute_dictionary_test() {
+}
+
+void attribute_dictionary_test::setUp() {
+    dict = new AttributeDictionary();
+    dict->intern({"c", "a", "b"});
+}
+
+void attribute_dictionary_test::tearDown() {
+    delete dict;
+}
+
+void attribute_dictionary_test::testIntern() {
+    CPPUNIT_ASSERT_MESSAGE("interning existing attribute failed",
+            dict->intern("b") == 1 && dict->size() == 3);
+    CPPUNIT_ASSERT_MESSAGE("interning new attribute failed",
+            dict->intern("x") == 3 && dict->size() == 4);
+}
+
+void attribute_dictionary_test::testIntern2() {
+    unsigned int a, b, c;
+    CPPUNIT_ASSERT_MESSAGE("identifiers do not follow the order of the set",
+            dict->find("a", a) && dict->find("b", b) && dict->find("c", c)
+            && a == 0 && b == 1 && c == 2);
+}
+
+void attribute_dictionary_test::testFind() {
+    unsigned int id = 7;
+    CPPUNIT_ASSERT_MESSAGE("find existing attribute failed",
+            dict->find("c", id) && id == 2);
+    CPPUNIT_ASSERT_MESSAGE("find non-existing attribute failed",
+            !dict->find("x", id) && id == 2);
+}
+
+void attribute_dictionary_test::testGetName() {
+    CPPUNIT_ASSERT_MESSAGE("getName failed",
+            dict->getName(0) == "a" && dict->getName(2) == "c");
+}
+
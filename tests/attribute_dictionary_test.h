@@ -0,0 +1,43 @@
+/*! @file attribute_dictionary_test.h
+ * 
+ * @brief Includes declaration for the class attribute_dictionary_test and its members.
+ *  
+ * @details
+ * This file declares the definition of the class attribute_dictionary_test along 
+ * with its subsequent data members and the member functions prototype. This class 
+ * is designed to test the methods from the AttributeDictionary class.
+ * 
+ */
+#ifndef ATTRIBUTE_DICTIONARY_TEST_H
+#define ATTRIBUTE_DICTIONARY_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../attribute_dictionary.h"
+
+class attribute_dictionary_test : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(attribute_dictionary_test);
+
+    CPPUNIT_TEST(testIntern);
+    CPPUNIT_TEST(testIntern2);
+    CPPUNIT_TEST(testFind);
+    CPPUNIT_TEST(testGetName);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    attribute_dictionary_test();
+    virtual ~attribute_dictionary_test();
+    void setUp();
+    void tearDown();
+
+private:
+    AttributeDictionary *dict;
+    void testIntern();
+    void testIntern2();
+    void testFind();
+    void testGetName();
+
+};
+
+#endif /* ATTRIBUTE_DICTIONARY_TEST_H */
+
@@ -0,0 +1,117 @@
+/*! \file cover_engine_test.cc
+ * 
+ * \brief Includes definitions of the cover_engine_test class members defined 
+ * in the cover_engine_test.h file
+ *  
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * cover_engine_test.
+ * 
+ */
+#include "cover_engine_test.h"
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(cover_engine_test);
+
+cover_engine_test::cover_engine_test() {
+}
+
+cover_engine_test::~cover_engine_test() {
+}
+
+void cover_engine_test::setUp() {
+    deps.insert(Dependency({"a"},
+    {
+        "b", "c"
+    }));
+    deps.insert(Dependency({"b"},
+    {
+        "c"
+    }));
+    deps.insert(Dependency({"a", "b"},
+    {
+        "c", "d"
+    }));
+}
+
+void cover_engine_test::tearDown() {
+    deps.clear();
+}
+
+void cover_engine_test::testCoverEngine() {
+    CoverEngine c(deps);
+    set_dep d = c.getDependencies();
+    Dependency d1({"a", "b"},
+    {
+        "c"
+    });
+    CPPUNIT_ASSERT_MESSAGE("failed to split the dependencies",
+            d.size() == 5 && contains(d, d1));
+}
+
+void cover_engine_test::testReduceLHS() {
+    CoverEngine c(deps);
+    Dependency d1({"a"},
+    {
+        "d"
+    });
+    bool change = c.reduceLHS();
+    set_dep d = c.getDependencies();
+    CPPUNIT_ASSERT_MESSAGE("failed to reduce the lhs",
+            change && !c.reduceLHS() && contains(d, d1) && d.size() == 4);
+}
+
+void cover_engine_test::testReduceRules() {
+    CoverEngine c(deps);
+    c.reduceLHS();
+    Dependency d1({"a"},
+    {
+        "c"
+    });
+    bool change = c.reduceRules();
+    set_dep d = c.getDependencies();
+    CPPUNIT_ASSERT_MESSAGE("failed to remove the redundant rules",
+            change && !c.reduceRules() && !contains(d, d1) && d.size() == 3);
+}
+
+void cover_engine_test::testGetDependencies() {
+    CoverEngine c(deps);
+    c.reduceLHS();
+    c.reduceRules();
+    Dependency d1({"a"},
+    {
+        "b", "d"
+    });
+    Dependency d2({"b"},
+    {
+        "c"
+    });
+    set_dep d = c.getDependencies(true);
+    CPPUNIT_ASSERT_MESSAGE("failed to merge the dependencies",
+            d.size() == 2 && contains(d, d1) && contains(d, d2));
+}
+
+void cover_engine_test::testLargeCover() {
+    set_dep large;
+    for (unsigned int i = 1; i <= 2000; ++i) {
+        string x = "x" + std::to_string(i), p = "x" + std::to_string(i - 1);
+        large.insert(Dependency({p},
+        {
+            x
+        }));
+        large.insert(Dependency({p, "y" + std::to_string(i)},
+        {
+            x
+        }));
+    }
+    CoverEngine c(large);
+    c.reduceLHS();
+    c.reduceRules();
+    set_dep d = c.getDependencies(true);
+    Dependency d1({"x0"},
+    {
+        "x1"
+    });
+    CPPUNIT_ASSERT_MESSAGE("failed to calculate the large minimal cover",
+            d.size() == 2000 && contains(d, d1));
+}
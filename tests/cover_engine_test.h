@@ -0,0 +1,46 @@
+/*! @file cover_engine_test.h
+ * 
+ * @brief Includes declaration for the class cover_engine_test and its members.
+ *  
+ * @details
+ * This file declares the definition of the class cover_engine_test along with 
+ * its subsequent data members and the member functions prototype. This class is
+ * designed to test the methods from the CoverEngine class.
+ * 
+ */
+#ifndef COVER_ENGINE_TEST_H
+#define COVER_ENGINE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../cover_engine.h"
+#include "../dependency.h"
+#include "../declaration.h"
+
+class cover_engine_test : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(cover_engine_test);
+
+    CPPUNIT_TEST(testCoverEngine);
+    CPPUNIT_TEST(testReduceLHS);
+    CPPUNIT_TEST(testReduceRules);
+    CPPUNIT_TEST(testGetDependencies);
+    CPPUNIT_TEST(testLargeCover);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    cover_engine_test();
+    virtual ~cover_engine_test();
+    void setUp();
+    void tearDown();
+
+private:
+    set_dep deps;
+    void testCoverEngine();
+    void testReduceLHS();
+    void testReduceRules();
+    void testGetDependencies();
+    void testLargeCover();
+
+};
+
+#endif /* COVER_ENGINE_TEST_H */
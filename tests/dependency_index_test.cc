@@ -0,0 +1,138 @@
+/*! \file dependency_index_test.cc
+ * 
+ * \brief Includes definitions of the dependency_index_test class members 
+ * defined in the dependency_index_test.h file
+ *  
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * dependency_index_test.
+ * 
+ */
+#include "dependency_index_test.h"
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(dependency_index_test);
+
+dependency_index_test::dependency_index_test() {
+}
+
+dependency_index_test::~dependency_index_test() {
+}
+
+void dependency_index_test::setUp() {
+    deps.insert(Dependency({"a"},
+    {
+        "b", "c"
+    }));
+    deps.insert(Dependency({"b", "d"},
+    {
+        "e"
+    }));
+    deps.insert(Dependency({"e"},
+    {
+        "a"
+    }));
+    index = new DependencyIndex();
+    index->build(deps);
+}
+
+void dependency_index_test::tearDown() {
+    delete index;
+    deps.clear();
+}
+
+void dependency_index_test::testBuild() {
+    DependencyIndex i;
+    CPPUNIT_ASSERT_MESSAGE("failed to build the index",
+            !i.isBuilt() && i.size() == 0
+            && index->isBuilt() && index->size() == 3);
+}
+
+void dependency_index_test::testFind() {
+    std::vector<itr_dep> a = index->find(string("a"));
+    std::vector<itr_dep> d = index->find(string("d"));
+    Dependency d1({"b", "d"},
+    {
+        "e"
+    });
+    CPPUNIT_ASSERT_MESSAGE("failed to find the dependencies of the attribute",
+            a.size() == 2 && d.size() == 1 && *d[0] == d1
+            && index->find(string("x")).empty());
+}
+
+void dependency_index_test::testFind2() {
+    std::vector<itr_dep> v = index->find(set_str({"a", "e", "x"}));
+    std::vector<itr_dep> c = index->find(set_str({"c"}));
+    bool ordered = v.size() == 3;
+    for (unsigned int i = 1; ordered && i < v.size(); ++i) {
+        ordered = *v[i - 1] < *v[i];
+    }
+    CPPUNIT_ASSERT_MESSAGE("failed to find the dependencies of the attributes",
+            ordered && c.size() == 1 && c[0] == deps.begin());
+}
+
+void dependency_index_test::testClear() {
+    index->clear();
+    bool cleared = !index->isBuilt() && index->find(string("a")).empty();
+    deps.erase(deps.begin());
+    index->build(deps);
+    CPPUNIT_ASSERT_MESSAGE("failed to clear the index",
+            cleared && index->size() == 2 && index->find(string("c")).empty()
+            && index->find(string("a")).size() == 1);
+}
+
+void dependency_index_test::testInsert() {
+    itr_dep i = deps.insert(Dependency({"c"},
+    {
+        "f"
+    })).first;
+    index->insert(i);
+    std::vector<itr_dep> c = index->find(string("c"));
+    std::vector<itr_dep> f = index->find(set_str({"f", "x"}));
+    CPPUNIT_ASSERT_MESSAGE("failed to insert the dependency",
+            index->size() == 4 && c.size() == 2 && c[0] == deps.begin()
+            && c[1] == i && f.size() == 1 && f[0] == i);
+}
+
+void dependency_index_test::testErase() {
+    itr_dep i = deps.begin();
+    index->erase(i);
+    deps.erase(i);
+    std::vector<itr_dep> a = index->find(string("a"));
+    CPPUNIT_ASSERT_MESSAGE("failed to erase the dependency",
+            index->size() == 2 && a.size() == 1 && a[0]->isPresentRhs("a")
+            && index->find(string("c")).empty() && index->isCompact());
+}
+
+void dependency_index_test::testBuild2() {
+    for (unsigned int n = 0; n < 40; ++n) {
+        itr_dep i = deps.insert(Dependency({"x" + std::to_string(n)},
+        {
+            "y"
+        })).first;
+        index->insert(i);
+        index->erase(i);
+        deps.erase(i);
+    }
+    bool compact = index->isCompact();
+    index->build(deps);
+    CPPUNIT_ASSERT_MESSAGE("failed to compact the index",
+            !compact && index->isCompact() && index->size() == 3
+            && index->find(string("x0")).empty()
+            && index->find(string("a")).size() == 2);
+}
+
+void dependency_index_test::testFind3() {
+    itr_dep i = deps.insert(Dependency({"a", "c"},
+    {
+        "x"
+    })).first;
+    index->insert(i);
+    itr_dep e = ++deps.begin();
+    index->erase(e);
+    deps.erase(e);
+    std::vector<itr_dep> v = index->find(set_str({"a", "d", "x"}));
+    CPPUNIT_ASSERT_MESSAGE("failed to merge the added dependencies",
+            v.size() == 3 && v[0] == deps.begin() && v[1] == i
+            && v[2] == --deps.end() && index->find(string("e")).size() == 1);
+}
@@ -0,0 +1,54 @@
+/*! @file dependency_index_test.h
+ * 
+ * @brief Includes declaration for the class dependency_index_test and its 
+ * members.
+ *  
+ * @details
+ * This file declares the definition of the class dependency_index_test along 
+ * with its subsequent data members and the member functions prototype. This 
+ * class is designed to test the methods from the DependencyIndex class.
+ * 
+ */
+#ifndef DEPENDENCY_INDEX_TEST_H
+#define DEPENDENCY_INDEX_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../dependency_index.h"
+#include "../dependency.h"
+#include "../declaration.h"
+
+class dependency_index_test : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(dependency_index_test);
+
+    CPPUNIT_TEST(testBuild);
+    CPPUNIT_TEST(testFind);
+    CPPUNIT_TEST(testFind2);
+    CPPUNIT_TEST(testClear);
+    CPPUNIT_TEST(testInsert);
+    CPPUNIT_TEST(testErase);
+    CPPUNIT_TEST(testBuild2);
+    CPPUNIT_TEST(testFind3);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    dependency_index_test();
+    virtual ~dependency_index_test();
+    void setUp();
+    void tearDown();
+
+private:
+    set_dep deps;
+    DependencyIndex *index;
+    void testBuild();
+    void testFind();
+    void testFind2();
+    void testClear();
+    void testInsert();
+    void testErase();
+    void testBuild2();
+    void testFind3();
+
+};
+
+#endif /* DEPENDENCY_INDEX_TEST_H */
@@ -60,6 +60,15 @@ void dependency_test::testDependency2() {
     CPPUNIT_ASSERT(isEqual(*ss1, d.lhs) && isEqual(*ss2, d.rhs));
 }
 
+void dependency_test::testDependency3() {
+    Dependency d(*dep);
+    Dependency e(std::move(d));
+    Dependency f(*ss2, *ss1);
+    f = std::move(e);
+    CPPUNIT_ASSERT(isEqual(*ss1, f.lhs) && isEqual(*ss2, f.rhs)
+            && d.lhs.empty() && d.rhs.empty());
+}
+
 void dependency_test::testAddLhs() {
     const string p = "e";
     dep->addLhs(p);
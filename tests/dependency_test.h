@@ -22,6 +22,7 @@ class dependency_test : public CPPUNIT_NS::TestFixture {
     CPPUNIT_TEST(testGetRhs);
     CPPUNIT_TEST(testGetAttribs);
     CPPUNIT_TEST(testDependency2);
+    CPPUNIT_TEST(testDependency3);
     CPPUNIT_TEST(testAddLhs);
     CPPUNIT_TEST(testAddRhs);
     CPPUNIT_TEST(testRemoveLhs);
@@ -58,6 +59,7 @@ private:
     void testGetRhs();
     void testGetAttribs();
     void testDependency2();
+    void testDependency3();
     void testAddLhs();
     void testAddRhs();
     void testRemoveLhs();
@@ -0,0 +1,112 @@
+/*! \file fd_table_test.cc
+ * 
+ * \brief Includes definitions of the fd_table_test class members defined in 
+ * the fd_table_test.h file
+ *  
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * fd_table_test.
+ * 
+ */
+#include "fd_table_test.h"
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(fd_table_test);
+
+fd_table_test::fd_table_test() {
+}
+
+fd_table_test::~fd_table_test() {
+}
+
+void fd_table_test::setUp() {
+    attributes = {"a", "b", "c", "d", "e"};
+    deps.insert(Dependency({"a"},
+    {
+        "b", "c"
+    }));
+    deps.insert(Dependency({"b", "d"},
+    {
+        "e"
+    }));
+    deps.insert(Dependency({"e"},
+    {
+        "a"
+    }));
+    table = new FDTable();
+    table->build(attributes, deps);
+}
+
+void fd_table_test::tearDown() {
+    delete table;
+    deps.clear();
+}
+
+void fd_table_test::testBuild() {
+    FDTable t;
+    unsigned int a, b, d;
+    const AttributeDictionary &dict = table->getDictionary();
+    bool found = dict.find("a", a) && dict.find("b", b) && dict.find("d", d);
+    itr_dep i = --deps.end();
+    const FDTable::word *l = table->getLhs(2);
+    CPPUNIT_ASSERT_MESSAGE("failed to build the table",
+            !t.isBuilt() && t.size() == 0 && table->isBuilt()
+            && table->size() == 3 && table->getWords() == 1 && found
+            && a == 0 && table->getDependency(2) == i
+            && table->getLhsSize(2) == 2
+            && l[0] == (((FDTable::word) 1 << b) | ((FDTable::word) 1 << d))
+            && table->getRhs(0)[0] == (FDTable::word) 6);
+}
+
+void fd_table_test::testToWords() {
+    std::vector<FDTable::word> x = table->toWords({"a", "c", "x"});
+    CPPUNIT_ASSERT_MESSAGE("failed to convert the attributes",
+            x.size() == 1 && x[0] == (FDTable::word) 5);
+}
+
+void fd_table_test::testFindCovered() {
+    std::vector<FDTable::word> x = table->toWords({"a", "b", "d"});
+    std::vector<FDTable::word> y = table->toWords({"c"});
+    unsigned int first = table->findCovered(x, 0);
+    unsigned int second = table->findCovered(x, first + 1);
+    CPPUNIT_ASSERT_MESSAGE("failed to find the covered dependencies",
+            first == 0 && second == 2
+            && table->findCovered(x, second + 1) == table->size()
+            && table->findCovered(y, 0) == table->size()
+            && table->findCovered(x, 5) == table->size());
+}
+
+void fd_table_test::testIntersectsRhs() {
+    std::vector<FDTable::word> x = table->toWords({"c", "e"});
+    CPPUNIT_ASSERT_MESSAGE("failed to test the rhs",
+            table->intersectsRhs(0, x) && !table->intersectsRhs(1, x)
+            && table->intersectsRhs(2, x));
+}
+
+void fd_table_test::testPostings() {
+    unsigned int b, c, e;
+    const AttributeDictionary &dict = table->getDictionary();
+    dict.find("b", b);
+    dict.find("c", c);
+    dict.find("e", e);
+    CPPUNIT_ASSERT_MESSAGE("failed to list the rows of the lhs attributes",
+            table->getOffset(0) == 0 && table->getOffset(1) == 1
+            && table->getPosting(0) == 0
+            && table->getOffset(b + 1) - table->getOffset(b) == 1
+            && table->getPosting(table->getOffset(b)) == 2
+            && table->getOffset(c + 1) == table->getOffset(c)
+            && table->getPosting(table->getOffset(e)) == 1
+            && table->getOffset(dict.size()) == 4);
+}
+
+void fd_table_test::testClear() {
+    table->clear();
+    bool cleared = !table->isBuilt() && table->size() == 0;
+    deps.erase(deps.begin());
+    attributes.insert("f");
+    table->build(attributes, deps);
+    unsigned int f;
+    CPPUNIT_ASSERT_MESSAGE("failed to clear the table",
+            cleared && table->size() == 2
+            && table->getDictionary().find("f", f) && f == 5);
+}
@@ -0,0 +1,50 @@
+/*! @file fd_table_test.h
+ * 
+ * @brief Includes declaration for the class fd_table_test and its members.
+ *  
+ * @details
+ * This file declares the definition of the class fd_table_test along with its 
+ * subsequent data members and the member functions prototype. This class is 
+ * designed to test the methods from the FDTable class.
+ * 
+ */
+#ifndef FD_TABLE_TEST_H
+#define FD_TABLE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../fd_table.h"
+#include "../dependency.h"
+#include "../declaration.h"
+
+class fd_table_test : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(fd_table_test);
+
+    CPPUNIT_TEST(testBuild);
+    CPPUNIT_TEST(testToWords);
+    CPPUNIT_TEST(testFindCovered);
+    CPPUNIT_TEST(testIntersectsRhs);
+    CPPUNIT_TEST(testPostings);
+    CPPUNIT_TEST(testClear);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    fd_table_test();
+    virtual ~fd_table_test();
+    void setUp();
+    void tearDown();
+
+private:
+    set_str attributes;
+    set_dep deps;
+    FDTable *table;
+    void testBuild();
+    void testToWords();
+    void testFindCovered();
+    void testIntersectsRhs();
+    void testPostings();
+    void testClear();
+
+};
+
+#endif /* FD_TABLE_TEST_H */
@@ -11,6 +11,8 @@
 
 #include "relation_test.h"
 #include "../relation.h"
+#include "../analyzer.h"
+#include <algorithm>
 
 
 CPPUNIT_TEST_SUITE_REGISTRATION(relation_test);
@@ -37,6 +39,7 @@ void relation_test::setUp() {
     {
         "e", "h"
     }));
+    rel->indexDependencies();
 }
 
 void relation_test::tearDown() {
@@ -76,6 +79,56 @@ void relation_test::testRelation2() {
             && isEqual(s.dependencies, rel->dependencies));
 }
 
+void relation_test::testRelation3() {
+    Relation s(*rel);
+    auto key = s.getCandidatekey();
+    Relation t(std::move(s));
+    itr_dep i = t.findDepLHS({"b", "c", "d"});
+    CPPUNIT_ASSERT_MESSAGE("move constructor failed",
+            rel->name == t.name
+            && isEqual(t.attributes, rel->attributes)
+            && isEqual(t.dependencies, rel->dependencies)
+            && i != t.dependencies.end() && t.getCandidatekey() == key
+            && s.dependencies.empty() && s.attributes.empty()
+            && s.findDepLHS({"b", "c", "d"}) == s.dependencies.end());
+}
+
+void relation_test::testRelation4() {
+    Relation s("S", {"x", "y"});
+    Relation t(*rel);
+    s = std::move(t);
+    itr_dep i = s.findDepLHS({"b", "c", "d"});
+    s.addDependency(Dependency({"b", "c", "d"},
+    {
+        "a"
+    }));
+    CPPUNIT_ASSERT_MESSAGE("move assignment failed",
+            rel->name == s.name
+            && isEqual(s.attributes, rel->attributes)
+            && i != s.dependencies.end()
+            && s.dependencies.size() == rel->dependencies.size()
+            && contains(s.findDepLHS({"b", "c", "d"})->rhs, string("a"))
+            && t.dependencies.empty());
+}
+
+void relation_test::testRelation5() {
+    Relation a(*rel), b(*rel), s("S", {"x"});
+    for (Relation *r : {&a, &b, &s}) {
+        r->getClosure({"a"});
+        r->getClosure({"a"});
+    }
+    s.addAtributte("y");
+    s.getClosure({"x"});
+    unsigned long hits = a.getClosureHits(), misses = a.getClosureMisses();
+    Relation c(std::move(a));
+    s = std::move(b);
+    CPPUNIT_ASSERT_MESSAGE("move failed to keep the cache counts",
+            hits == 1 && misses == 1
+            && c.getClosureHits() == hits && c.getClosureMisses() == misses
+            && s.getClosureHits() == hits && s.getClosureMisses() == misses
+            && a.getClosureHits() == 0 && b.getClosureMisses() == 0);
+}
+
 void relation_test::testAddAtributte() {
     const string p = "i", p1 = "a";
 
@@ -107,6 +160,53 @@ void relation_test::testRemoveAtributte() {
             !rel->removeAtributte(q) && !contains(rel->attributes, q));
 }
 
+void relation_test::testRemoveAtributte2() {
+    set_dep d;
+    for (unsigned int i = 0; i < 3000; ++i) {
+        d.insert(Dependency({"x" + std::to_string(i)},
+        {
+            "x" + std::to_string(i + 1), "c"
+        }));
+    }
+    Relation r("A",{}, d);
+    Dependency d1({"x99"},
+    {
+        "x100"
+    });
+    Dependency d2({"c"},
+    {
+        "y"
+    });
+    bool removed = r.removeAtributte("c") && r.dependencies.size() == 3000
+            && contains(r.dependencies, d1) && !r.isDepAttribPresent(d2);
+    CPPUNIT_ASSERT_MESSAGE("failed to remove the attribute of many dependencies",
+            removed && r.removeAtributte("x100") && r.dependencies.size() == 2998
+            && r.findDepLHS({"x99"}) == r.dependencies.end()
+            && !r.removeAtributte("c"));
+}
+
+void relation_test::testRemoveAtributte3() {
+    set_dep d;
+    for (unsigned int i = 0; i < 200; ++i) {
+        d.insert(Dependency({"x" + std::to_string(i)},
+        {
+            "x" + std::to_string(i + 1)
+        }));
+    }
+    Relation r("A",{}, d);
+    bool kept = r.removeAtributte("x10") && r.attributeIndex.isBuilt();
+    for (unsigned int i = 20; i < 30; ++i) {
+        kept = kept && r.removeAtributte("x" + std::to_string(i))
+                && r.attributeIndex.isBuilt() && r.attributeIndex.isCompact();
+    }
+    std::vector<itr_dep> found = r.getAttributeIndex().find(string("x50"));
+    CPPUNIT_ASSERT_MESSAGE("failed to keep the index of the attributes",
+            kept && r.attributeIndex.size() == r.dependencies.size()
+            && r.dependencies.size() == 200 - 2 - 11
+            && found.size() == 2 && found[0]->isPresentRhs("x50")
+            && found[1]->isPresentLhs("x50"));
+}
+
 void relation_test::testRemoveDependency() {
     const set_str p0 = {"a", "c"};
     const set_str p1 = {"d"};
@@ -162,6 +262,31 @@ void relation_test::testAddDependencies() {
 
 }
 
+void relation_test::testAddDependencies2() {
+    set_dep d;
+    for (unsigned int i = 0; i < 5000; ++i) {
+        d.insert(Dependency({"x" + std::to_string(i)},
+        {
+            "y" + std::to_string(i)
+        }));
+        d.insert(Dependency({"x" + std::to_string(i)},
+        {
+            "z" + std::to_string(i % 7)
+        }));
+    }
+    Relation r("B");
+    unsigned int size = r.addDependencies(d);
+    Relation c(r);
+    Dependency d1({"x42"},
+    {
+        "y42", "z0"
+    });
+    CPPUNIT_ASSERT_MESSAGE("bulk load of the dependencies failed",
+            size == 10000 && r.dependencies.size() == 5000
+            && contains(r.dependencies, d1) && r.attributes.size() == 10007
+            && c.dependencies.size() == 5000 && contains(c.dependencies, d1));
+}
+
 void relation_test::testAddDependency() {
     const set_str p0 = {"a"};
     const set_str p1 = {"c", "e", "b", "f"};
@@ -204,6 +329,39 @@ void relation_test::testFindDepLHS() {
             rel->findDepLHS(p1) == rel->dependencies.end());
 }
 
+void relation_test::testFindDepLHS2() {
+    Relation r("H");
+    for (unsigned int i = 0; i < 2000; ++i) {
+        r.addDependency({"x" + std::to_string(i)},
+        {
+            "y" + std::to_string(i)
+        });
+    }
+    r.addDependency({"x7"},
+    {
+        "z"
+    });
+    r.removeDependency({"x8"},
+    {
+        "y8"
+    });
+    r.removeAtributte("x9");
+    Relation c("C");
+    c = r;
+    r.clearDependencies();
+    Dependency d({"x7"},
+    {
+        "y7", "z"
+    });
+    CPPUNIT_ASSERT_MESSAGE("failed to keep the index of the lhs",
+            r.findDepLHS({"x7"}) == r.dependencies.end()
+            && c.dependencies.size() == 1998
+            && *(c.findDepLHS({"x7"})) == d
+            && c.findDepLHS({"x8"}) == c.dependencies.end()
+            && c.findDepLHS({"x9"}) == c.dependencies.end()
+            && c.findDepLHS({"x1999"}) != c.dependencies.end());
+}
+
 void relation_test::testIsNormal() {
     //    bool result = rel->isNormal(Relation::_2NF);
     CPPUNIT_ASSERT_MESSAGE("test normal failed", !rel->isNormal(Relation::_2NF)
@@ -237,6 +395,34 @@ void relation_test::testIsSuperkey() {
             && !rel->isSuperkey(c) && rel->isSuperkey(d));
 }
 
+void relation_test::testIsSuperkey2() {
+    Relation r("S");
+    for (unsigned int i = 0; i < 20; ++i) {
+        r.addDependency({"a" + std::to_string(i)},
+        {
+            "b" + std::to_string(i)
+        });
+        r.addDependency({"b" + std::to_string(i)},
+        {
+            "a" + std::to_string(i)
+        });
+    }
+    set_str k, l;
+    for (unsigned int i = 0; i < 20; ++i) {
+        k.insert((i % 2 ? "a" : "b") + std::to_string(i));
+    }
+    l = k;
+    l.insert("b1");
+    std::vector<set_str> lhs = {l, {"a0"}, k, {"a1", "b1"}};
+    lhs[3].insert("x");
+    std::vector<bool> res = r.isSuperkey(lhs);
+    CPPUNIT_ASSERT_MESSAGE("failed to check attribute sets for super key",
+            res.size() == 4 && res[0] && !res[1] && res[2] && !res[3]
+            && r.isSuperkey(l) && !r.isSuperkey(lhs[3])
+            && !r.isNormal(Relation::_BCNF)
+            && r.getViolation(Relation::_BCNF).size() == 40);
+}
+
 void relation_test::testIsPartialkey() {
     set_str a = {"a"};
     set_str b = {"a", "c"};
@@ -258,6 +444,121 @@ void relation_test::testIsPrime() {
             && !rel->isPrime(c) && !rel->isPrime(d));
 }
 
+void relation_test::testIsPrime2() {
+    Relation r("P", {"a", "b", "c", "d"});
+    r.addDependency({"a", "c"},
+    {
+        "b", "d"
+    });
+    r.addDependency({"b"},
+    {
+        "a"
+    });
+    set_str a = {"a", "b", "c"};
+    set_str b = {"b", "d"};
+    CPPUNIT_ASSERT_MESSAGE("failed to check attributes of different keys",
+            r.getCandidatekey().size() == 2 && r.isPrime(a)
+            && !r.isPrime(b) && r.isNormal(Relation::_3NF)
+            && !r.isNormal(Relation::_BCNF));
+}
+
+void relation_test::testIsPrime3() {
+    Relation r("P", {"a", "b", "c", "d"});
+    r.addDependency({"c", "d"},
+    {
+        "a", "b"
+    });
+    r.addDependency({"a"},
+    {
+        "b"
+    });
+    r.addDependency({"b"},
+    {
+        "a", "c"
+    });
+    set_str a = {"a", "c"};
+    set_str b = {"a", "b", "c", "d"};
+    CPPUNIT_ASSERT_MESSAGE("failed to test every attribute to be prime",
+            r.getCandidatekey().size() == 3 && r.isPrime(a) && r.isPrime(b)
+            && !r.isSuperkey({"b"}) && r.isNormal(Relation::_3NF));
+}
+
+void relation_test::testGetPrimeAttributes() {
+    Relation r("P", {"a", "b", "c", "d", "e", "f"});
+    r.addDependency({"a", "b"},
+    {
+        "c"
+    });
+    r.addDependency({"c", "d"},
+    {
+        "a"
+    });
+    r.addDependency({"b", "c"},
+    {
+        "e"
+    });
+    r.addDependency({"e"},
+    {
+        "f"
+    });
+    bool ok = true;
+    for (Relation::KeyEngine e : {Relation::_LEVELWISE,
+            Relation::_LUCCHESI_OSBORN, Relation::_PARALLEL}) {
+        Relation p(r), k(r);
+        p.setKeyEngine(e);
+        k.setKeyEngine(e);
+        set_str targeted = p.getPrimeAttributes(), primes;
+        for (const set_str &key : k.getCandidatekey()) {
+            primes.insert(key.begin(), key.end());
+        }
+        ok = ok && isEqual(targeted, primes)
+                && isEqual(primes, set_str({"a", "b", "c", "d"}));
+    }
+    unsigned int seed = 7;
+    for (unsigned int t = 0; t < 30; ++t) {
+        Relation g("G", {"a", "b", "c", "d", "e", "f", "g"});
+        for (unsigned int n = 0; n < 6; ++n) {
+            set_str lhs, rhs;
+            for (const string &a : g.getAttributes()) {
+                seed = seed * 1103515245 + 12345;
+                unsigned int v = (seed >> 16) % 6;
+                if (v == 0)
+                    lhs.insert(a);
+                else if (v == 1)
+                    rhs.insert(a);
+            }
+            if (!lhs.empty())
+                g.addDependency(lhs, rhs);
+        }
+        Relation p(g), k(g);
+        set_str primes;
+        for (const set_str &key : k.getCandidatekey()) {
+            primes.insert(key.begin(), key.end());
+        }
+        ok = ok && isEqual(p.getPrimeAttributes(), primes);
+    }
+
+    Relation w("W");
+    for (unsigned int i = 0; i < 20; ++i) {
+        std::string x = "x" + std::to_string(i), y = "y" + std::to_string(i);
+        w.addDependency({x},
+        {
+            y, "z"
+        });
+        w.addDependency({y},
+        {
+            x
+        });
+    }
+    set_str p = w.getPrimeAttributes();
+    KeySearchOptions options;
+    options.maxNodes = 1;
+    CPPUNIT_ASSERT_MESSAGE("failed to get the prime attributes",
+            ok && p.size() == 40 && !contains(p, std::string("z"))
+            && !w.getCandidatekey(options).complete
+            && w.isPrime({"x3", "y7"}) && !w.isPrime({"x3", "z"}));
+}
+
 void relation_test::testGetClosure() {
     set_str b = {"a", "c"};
     set_str c = {"b"};
@@ -266,6 +567,74 @@ void relation_test::testGetClosure() {
             && isEqual(rel->getClosure(c), c));
 }
 
+void relation_test::testGetClosure2() {
+    Relation r("W");
+    for (unsigned int i = 1; i < 300; ++i) {
+        r.addDependency({"x" + std::to_string(i - 1)},
+        {
+            "x" + std::to_string(i)
+        });
+    }
+    set_str c = r.getClosure({"x150"});
+    CPPUNIT_ASSERT_MESSAGE("closure operation on wide relation failed",
+            r.attributes.size() == 300
+            && isEqual(r.getClosure({"x0"}), r.attributes)
+            && c.size() == 150 && contains(c, string("x299"))
+            && !contains(c, string("x149")));
+}
+
+void relation_test::testGetClosure3() {
+    Relation r("W");
+    for (unsigned int i = 400; i > 1; --i) {
+        r.addDependency({"x" + std::to_string(i - 2), "x" + std::to_string(i - 1)},
+        {
+            "x" + std::to_string(i)
+        });
+    }
+    set_str c = r.getClosure({"x200", "x201"});
+    CPPUNIT_ASSERT_MESSAGE("closure operation on reversed chain failed",
+            r.attributes.size() == 401
+            && isEqual(r.getClosure({"x0", "x1"}), r.attributes)
+            && r.getClosure({"x0"}).size() == 1
+            && c.size() == 201 && contains(c, string("x400"))
+            && !contains(c, string("x199")));
+}
+
+void relation_test::testImplies() {
+    std::vector<Dependency> deps;
+    deps.push_back(Dependency({"a", "c"},
+    {
+        "e", "h"
+    }));
+    deps.push_back(Dependency({"a"},
+    {
+        "d"
+    }));
+    deps.push_back(Dependency({"c", "x"},
+    {
+        "x"
+    }));
+    deps.push_back(Dependency({"c"},
+    {
+        "x"
+    }));
+    std::vector<bool> v = rel->impliesAll(deps);
+    bool batch = v.size() == 4 && v[0] && !v[1] && v[2] && !v[3];
+    CPPUNIT_ASSERT_MESSAGE("failed to test the implied dependencies",
+            batch && rel->implies({"a", "c"},
+    {
+        "e", "h"
+    }) && rel->implies({"a"},
+    {
+        "a", "b", "f"
+    }) && !rel->implies({"b", "c"},
+    {
+        "e"
+    }) && rel->implies({"b", "c"},
+    {
+    }));
+}
+
 void relation_test::testGetCandidatekey() {
     set_str b = {"a", "c"};
 //    std::cout<<rel->getCandidatekey()<<std::endl;
@@ -274,6 +643,256 @@ void relation_test::testGetCandidatekey() {
             && rel->getCandidatekey().size() == 1);
 }
 
+void relation_test::testGetCandidatekey2() {
+    Relation r("K", {"a", "b", "c", "d", "e"});
+    r.addDependency({"a", "b"},
+    {
+        "c"
+    });
+    r.addDependency({"c"},
+    {
+        "a"
+    });
+    r.addDependency({"d"},
+    {
+        "b", "e"
+    });
+    r.addDependency({"e"},
+    {
+        "d"
+    });
+    set_key lo = r.getCandidatekey();
+    r.setKeyEngine(Relation::_LEVELWISE);
+    set_key lw = r.getCandidatekey();
+    rel->setKeyEngine(Relation::_LEVELWISE);
+    CPPUNIT_ASSERT_MESSAGE("key engines returned different keys",
+            lo.size() == 4 && lo == lw
+            && rel->getKeyEngine() == Relation::_LEVELWISE
+            && contains(rel->getCandidatekey(), set_str({"a", "c"})));
+}
+
+void relation_test::testGetCandidatekey3() {
+    Relation r("K");
+    set_str lhs;
+    for (unsigned int i = 0; i < 29; ++i) {
+        lhs.insert("x" + std::to_string(i));
+    }
+    r.addDependency(lhs,{"x29"});
+    r.addDependency({"x29"},
+    {
+        "x0"
+    });
+    set_str k = lhs;
+    k.erase("x0");
+    k.insert("x29");
+    set_key keys = r.getCandidatekey();
+    CPPUNIT_ASSERT_MESSAGE("candidate keys of wide relation are invalid",
+            keys.size() == 2 && contains(keys, lhs) && contains(keys, k));
+}
+
+void relation_test::testGetCandidatekey4() {
+    Relation r("K", {"a", "b", "c", "d", "e", "f"});
+    r.dependencies.insert(Dependency({"a", "b"},
+    {
+        "c", "d"
+    }));
+    r.dependencies.insert(Dependency({"c"},
+    {
+        "b"
+    }));
+    r.dependencies.insert(Dependency({"z"},
+    {
+        "e"
+    }));
+    set_key lo = r.getCandidatekey();
+    r.setKeyEngine(Relation::_LEVELWISE);
+    set_key lw = r.getCandidatekey();
+    CPPUNIT_ASSERT_MESSAGE("candidate keys with pruned attributes are invalid",
+            lo == lw && lo.size() == 2
+            && contains(lo, set_str({"a", "b", "e", "f"}))
+            && contains(lo, set_str({"a", "c", "e", "f"})));
+}
+
+void relation_test::testGetCandidatekey5() {
+    Relation r("K");
+    for (unsigned int i = 0; i < 8; ++i) {
+        r.addDependency({"a" + std::to_string(i)},
+        {
+            "b" + std::to_string(i)
+        });
+        r.addDependency({"b" + std::to_string(i)},
+        {
+            "a" + std::to_string(i)
+        });
+    }
+    r.addAtributte("c");
+    r.setKeyEngine(Relation::_PARALLEL);
+    set_key p = r.getCandidatekey();
+    r.setKeyEngine(Relation::_LEVELWISE);
+    set_key lw = r.getCandidatekey();
+    r.setKeyEngine(Relation::_LUCCHESI_OSBORN);
+    set_key lo = r.getCandidatekey();
+    CPPUNIT_ASSERT_MESSAGE("parallel key engine returned different keys",
+            p.size() == 256 && p == lw && p == lo
+            && contains(p, set_str({"a0", "a1", "a2", "a3", "b4", "b5", "b6",
+        "b7", "c"})));
+}
+
+void relation_test::testKeys() {
+    Relation r("K");
+    for (unsigned int i = 0; i < 8; ++i) {
+        r.addDependency({"a" + std::to_string(i)},
+        {
+            "b" + std::to_string(i)
+        });
+        r.addDependency({"b" + std::to_string(i)},
+        {
+            "a" + std::to_string(i)
+        });
+    }
+    set_str first;
+    KeyGenerator g = r.keys();
+    bool found = g.next(first) && r.isSuperkey(first);
+    unsigned long misses = r.getClosureMisses();
+    r.addAtributte("c");
+    set_key keys;
+    for (const set_str &k : g) {
+        keys.insert(k);
+    }
+    keys.insert(first);
+    set_key all;
+    for (const set_str &k : r.keys()) {
+        all.insert(k);
+    }
+    CPPUNIT_ASSERT_MESSAGE("key generator failed", found && misses < 256
+            && keys.size() == 256 && !contains(*keys.begin(), string("c"))
+            && all.size() == 256 && contains(*all.begin(), string("c"))
+            && all == r.getCandidatekey());
+}
+
+void relation_test::testGetAnyCandidateKey() {
+    Relation r("K", {"c"});
+    for (unsigned int i = 0; i < 20; ++i) {
+        r.addDependency({"a" + std::to_string(i)},
+        {
+            "b" + std::to_string(i)
+        });
+        r.addDependency({"b" + std::to_string(i)},
+        {
+            "a" + std::to_string(i)
+        });
+    }
+    set_str k = r.getAnyCandidateKey();
+    set_rel res = r.decomposePreserving();
+    Relation e("E");
+    CPPUNIT_ASSERT_MESSAGE("failed to find a candidate key",
+            isEqual(rel->getAnyCandidateKey(), set_str({"a", "c"}))
+            && k.size() == 21 && contains(k, string("c")) && r.isSuperkey(k)
+            && !r.isPartialkey(k) && res.size() == 21
+            && contains(res, Relation("K1", k))
+            && e.getAnyCandidateKey().empty());
+}
+
+void relation_test::testGetCandidatekeyLimited() {
+    Relation r("K");
+    for (unsigned int i = 0; i < 20; ++i) {
+        r.addDependency({"a" + std::to_string(i)},
+        {
+            "b" + std::to_string(i)
+        });
+        r.addDependency({"b" + std::to_string(i)},
+        {
+            "a" + std::to_string(i)
+        });
+    }
+    KeySearchOptions o;
+    o.maxKeys = 10;
+    KeySearchResult r1 = r.getCandidatekey(o);
+    o.maxKeys = 0;
+    o.maxNodes = 1000;
+    KeySearchResult r2 = r.getCandidatekey(o);
+    o.maxNodes = 0;
+    o.timeLimit = 50;
+    KeySearchResult r3 = r.getCandidatekey(o);
+    KeySearchOptions s;
+    s.maxKeySize = 2;
+    KeySearchResult r4 = rel->getCandidatekey(s);
+    s.maxKeySize = 1;
+    KeySearchResult r5 = rel->getCandidatekey(s);
+    CPPUNIT_ASSERT_MESSAGE("limited candidate key search failed",
+            r1.keys.size() == 10 && !r1.complete
+            && r2.keys.size() > 10 && r2.keys.size() < 200 && !r2.complete
+            && !r3.complete && r3.keys.size() >= r2.keys.size()
+            && r4.complete && r4.keys == rel->getCandidatekey()
+            && r5.complete && r5.keys.empty());
+}
+
+void relation_test::testGetCandidatekeyLimited2() {
+    Relation r("K", {"a"});
+    set_str x;
+    for (unsigned int i = 0; i < 20; ++i) {
+        x.insert("x" + std::to_string(i));
+        r.addDependency({"a"},
+        {
+            "x" + std::to_string(i)
+        });
+        r.addDependency({"x" + std::to_string(i)},
+        {
+            "y" + std::to_string(i)
+        });
+        r.addDependency({"y" + std::to_string(i)},
+        {
+            "x" + std::to_string(i)
+        });
+    }
+    r.addDependency(x,{"a"});
+    Relation l(r), p(r);
+    l.setKeyEngine(Relation::_LEVELWISE);
+    p.setKeyEngine(Relation::_PARALLEL);
+    KeySearchOptions o;
+    o.maxNodes = 1;
+    KeySearchResult r1 = r.getCandidatekey(o);
+    o.maxNodes = 100;
+    KeySearchResult r2 = l.getCandidatekey(o);
+    KeySearchResult r3 = p.getCandidatekey(o);
+    o.maxKeySize = 1;
+    KeySearchResult r4 = r.getCandidatekey(o);
+    set_key a;
+    a.insert({"a"});
+    CPPUNIT_ASSERT_MESSAGE("limited candidate key search failed",
+            r1.keys.empty() && !r1.complete
+            && r2.keys == a && !r2.complete
+            && r3.keys == a && !r3.complete
+            && r4.keys == a && r4.complete);
+}
+
+void relation_test::testIsNormalLimited() {
+    Relation r("K", {"c"});
+    for (unsigned int i = 0; i < 12; ++i) {
+        r.addDependency({"a" + std::to_string(i)},
+        {
+            "b" + std::to_string(i)
+        });
+        r.addDependency({"b" + std::to_string(i)},
+        {
+            "a" + std::to_string(i)
+        });
+    }
+    KeySearchOptions o;
+    o.maxKeys = 4;
+    bool c1, c2, c3, c4;
+    bool n1 = r.isNormal(Relation::_3NF, o, c1);
+    bool n2 = r.isNormal(Relation::_BCNF, o, c2);
+    r.addDependency({"c"},
+    {
+        "d"
+    });
+    bool n3 = r.isNormal(Relation::_3NF, o, c3);
+    bool n4 = rel->isNormal(Relation::_2NF, o, c4);
+    CPPUNIT_ASSERT_MESSAGE("limited normal form test failed",
+            !n1 && !c1 && !n2 && c2 && !n3 && !c3 && !n4 && c4);
+}
+
 void relation_test::testGetViolation() {
     Dependency d1({"a"},
     {
@@ -360,6 +979,35 @@ void relation_test::testDecomposeNotPreserving() {
 
 }
 
+void relation_test::testDecomposeNotPreserving2() {
+    Relation s("S", {"a", "b", "c", "d"});
+    s.addDependency({"a"},
+    {
+        "b", "d"
+    });
+    s.addDependency({"b"},
+    {
+        "c", "x"
+    }, false);
+    s.addDependency({"b"},
+    {
+        "c"
+    });
+    set_rel res = s.decomposeNotPreserving();
+    Relation s1("S1", {"a", "b", "d"}), s2("S2", {"b", "c"});
+    s1.addDependency({"a"},
+    {
+        "b", "d"
+    });
+    s2.addDependency({"b"},
+    {
+        "c"
+    });
+    CPPUNIT_ASSERT_MESSAGE("Invalid sub-relations of the decomposition",
+            res.size() == 2 && std::find(res.begin(), res.end(), s1) != res.end()
+            && std::find(res.begin(), res.end(), s2) != res.end());
+}
+
 void relation_test::testClearDependencies() {
     rel->clearDependencies();
     CPPUNIT_ASSERT_MESSAGE("clear dependencies failed", 
@@ -391,4 +1039,42 @@ void relation_test::testSetName() {
     CPPUNIT_ASSERT_MESSAGE("setName failed", rel->name == "S");
 }
 
+void relation_test::testGetAnalyzer() {
+    Relation r("W");
+    for (unsigned int i = 0; i < 100; ++i) {
+        r.addAtributte("x" + std::to_string(i));
+    }
+    CPPUNIT_ASSERT_MESSAGE("analyzer width selection failed",
+            rel->getAnalyzer().getWidth() == 64
+            && r.getAnalyzer().getWidth() == 128);
+    r.addAtributte("y");
+    for (unsigned int i = 100; i < 600; ++i) {
+        r.addAtributte("x" + std::to_string(i));
+    }
+    CPPUNIT_ASSERT_MESSAGE("analyzer is not updated after modification",
+            r.getAnalyzer().getWidth() == 0
+            && r.getAnalyzer().getDictionary().size() == 601);
+}
+
+void relation_test::testClosureCache() {
+    Relation r("C", {"a", "b", "c"});
+    r.addDependency({"a"},
+    {
+        "b"
+    });
+    set_str c1 = r.getClosure({"a"});
+    unsigned long hits = r.getClosureHits(), misses = r.getClosureMisses();
+    set_str c2 = r.getClosure({"a"});
+    bool cached = r.getClosureHits() == hits + 1
+            && r.getClosureMisses() == misses && isEqual(c1, c2);
+    r.addDependency({"b"},
+    {
+        "c"
+    });
+    set_str c3 = r.getClosure({"a"});
+    CPPUNIT_ASSERT_MESSAGE("closure cache failed", cached
+            && r.getClosureHits() == hits + 1
+            && r.getClosureMisses() == misses + 1
+            && c2.size() == 2 && c3.size() == 3);
+}
 
@@ -19,32 +19,58 @@ class relation_test : public CPPUNIT_NS::TestFixture {
 
     CPPUNIT_TEST(testRelation);
     CPPUNIT_TEST(testRelation2);
+    CPPUNIT_TEST(testRelation3);
+    CPPUNIT_TEST(testRelation4);
+    CPPUNIT_TEST(testRelation5);
     CPPUNIT_TEST(testAddAtributte);
     CPPUNIT_TEST(testAddAtributtes);
     CPPUNIT_TEST(testRemoveAtributte);
+    CPPUNIT_TEST(testRemoveAtributte2);
+    CPPUNIT_TEST(testRemoveAtributte3);
     CPPUNIT_TEST(testRemoveDependency);
     CPPUNIT_TEST(testRemoveDependency2);
     CPPUNIT_TEST(testAddDependencies);
+    CPPUNIT_TEST(testAddDependencies2);
     CPPUNIT_TEST(testAddDependency);
     CPPUNIT_TEST(testAddDependency2);
     CPPUNIT_TEST(testFindDepLHS);
+    CPPUNIT_TEST(testFindDepLHS2);
     CPPUNIT_TEST(testIsNormal);
     CPPUNIT_TEST(testIsDepAttribPresent);
     CPPUNIT_TEST(testIsSuperkey);
+    CPPUNIT_TEST(testIsSuperkey2);
     CPPUNIT_TEST(testIsPartialkey);
     CPPUNIT_TEST(testIsPrime);
+    CPPUNIT_TEST(testIsPrime2);
+    CPPUNIT_TEST(testIsPrime3);
+    CPPUNIT_TEST(testGetPrimeAttributes);
     CPPUNIT_TEST(testGetClosure);
+    CPPUNIT_TEST(testGetClosure2);
+    CPPUNIT_TEST(testGetClosure3);
+    CPPUNIT_TEST(testImplies);
     CPPUNIT_TEST(testGetCandidatekey);
+    CPPUNIT_TEST(testGetCandidatekey2);
+    CPPUNIT_TEST(testGetCandidatekey3);
+    CPPUNIT_TEST(testGetCandidatekey4);
+    CPPUNIT_TEST(testGetCandidatekey5);
+    CPPUNIT_TEST(testKeys);
+    CPPUNIT_TEST(testGetAnyCandidateKey);
+    CPPUNIT_TEST(testGetCandidatekeyLimited);
+    CPPUNIT_TEST(testGetCandidatekeyLimited2);
+    CPPUNIT_TEST(testIsNormalLimited);
     CPPUNIT_TEST(testGetViolation);
     CPPUNIT_TEST(testGetMinimalCover);
     CPPUNIT_TEST(testDecomposePreserving);
     CPPUNIT_TEST(testDecomposeNotPreserving);
+    CPPUNIT_TEST(testDecomposeNotPreserving2);
     CPPUNIT_TEST(testClearDependencies);
     CPPUNIT_TEST(testClearAttributes);
     CPPUNIT_TEST(testGetAttributes);
     CPPUNIT_TEST(testGetDependencies);
     CPPUNIT_TEST(testGetName);
     CPPUNIT_TEST(testSetName);
+    CPPUNIT_TEST(testGetAnalyzer);
+    CPPUNIT_TEST(testClosureCache);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -58,32 +84,58 @@ private:
     Relation *rel;
     void testRelation();
     void testRelation2();
+    void testRelation3();
+    void testRelation4();
+    void testRelation5();
     void testAddAtributte();
     void testAddAtributtes();
     void testRemoveAtributte();
+    void testRemoveAtributte2();
+    void testRemoveAtributte3();
     void testRemoveDependency();
     void testRemoveDependency2();
     void testAddDependencies();
+    void testAddDependencies2();
     void testAddDependency();
     void testAddDependency2();
     void testFindDepLHS();
+    void testFindDepLHS2();
     void testIsNormal();
     void testIsDepAttribPresent();
     void testIsSuperkey();
+    void testIsSuperkey2();
     void testIsPartialkey();
     void testIsPrime();
+    void testIsPrime2();
+    void testIsPrime3();
+    void testGetPrimeAttributes();
     void testGetClosure();
+    void testGetClosure2();
+    void testGetClosure3();
+    void testImplies();
     void testGetCandidatekey();
+    void testGetCandidatekey2();
+    void testGetCandidatekey3();
+    void testGetCandidatekey4();
+    void testGetCandidatekey5();
+    void testKeys();
+    void testGetAnyCandidateKey();
+    void testGetCandidatekeyLimited();
+    void testGetCandidatekeyLimited2();
+    void testIsNormalLimited();
     void testGetViolation();
     void testGetMinimalCover();
     void testDecomposePreserving();
     void testDecomposeNotPreserving();
+    void testDecomposeNotPreserving2();
     void testClearDependencies();
     void testClearAttributes();
     void testGetAttributes();
     void testGetDependencies();
     void testGetName();
     void testSetName();
+    void testGetAnalyzer();
+    void testClosureCache();
     
 
 };
@@ -0,0 +1,74 @@
+/*! \file set_trie_test.cc
+ * 
+ * \brief Includes definitions of the set_trie_test class members defined in 
+ * the set_trie_test.h file
+ *  
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * set_trie_test.
+ * 
+ */
+#include "set_trie_test.h"
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(set_trie_test);
+
+set_trie_test::set_trie_test() {
+}
+
+set_trie_test::~set_trie_test() {
+}
+
+void set_trie_test::setUp() {
+    trie = new SetTrie<string>();
+    set_str a = {"a", "c"};
+    set_str b = {"b", "c", "d"};
+    set_str c = {"a", "d", "e"};
+    trie->insert(a.begin(), a.end());
+    trie->insert(b.begin(), b.end());
+    trie->insert(c.begin(), c.end());
+}
+
+void set_trie_test::tearDown() {
+    delete trie;
+}
+
+void set_trie_test::testInsert() {
+    set_str a = {"a", "c"};
+    set_str b = {"a"};
+    CPPUNIT_ASSERT_MESSAGE("failed to insert set in trie",
+            !trie->insert(a.begin(), a.end()) && trie->size() == 3
+            && trie->insert(b.begin(), b.end()) && trie->size() == 4);
+}
+
+void set_trie_test::testHasSubset() {
+    set_str a = {"a", "b", "c"};
+    set_str b = {"a", "b", "d"};
+    set_str c = {"b", "c", "d", "e"};
+    set_str d;
+    CPPUNIT_ASSERT_MESSAGE("failed to find subset in trie",
+            trie->hasSubset(a.begin(), a.end())
+            && !trie->hasSubset(b.begin(), b.end())
+            && trie->hasSubset(c.begin(), c.end())
+            && !trie->hasSubset(d.begin(), d.end()));
+}
+
+void set_trie_test::testHasSuperset() {
+    set_str a = {"a", "e"};
+    set_str b = {"a", "b"};
+    set_str c = {"c", "d"};
+    set_str d;
+    CPPUNIT_ASSERT_MESSAGE("failed to find superset in trie",
+            trie->hasSuperset(a.begin(), a.end())
+            && !trie->hasSuperset(b.begin(), b.end())
+            && trie->hasSuperset(c.begin(), c.end())
+            && trie->hasSuperset(d.begin(), d.end()));
+}
+
+void set_trie_test::testClear() {
+    set_str a = {"a", "c"};
+    trie->clear();
+    CPPUNIT_ASSERT_MESSAGE("failed to clear the trie",
+            trie->empty() && !trie->hasSuperset(a.begin(), a.end())
+            && !trie->hasSubset(a.begin(), a.end()));
+}
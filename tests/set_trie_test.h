@@ -0,0 +1,44 @@
+/*! @file set_trie_test.h
+ * 
+ * @brief Includes declaration for the class set_trie_test and its members.
+ *  
+ * @details
+ * This file declares the definition of the class set_trie_test along with its 
+ * subsequent data members and the member functions prototype. This class is 
+ * designed to test the methods from the SetTrie class template.
+ * 
+ */
+#ifndef SET_TRIE_TEST_H
+#define SET_TRIE_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../set_trie.h"
+#include "../declaration.h"
+
+class set_trie_test : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(set_trie_test);
+
+    CPPUNIT_TEST(testInsert);
+    CPPUNIT_TEST(testHasSubset);
+    CPPUNIT_TEST(testHasSuperset);
+    CPPUNIT_TEST(testClear);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    set_trie_test();
+    virtual ~set_trie_test();
+    void setUp();
+    void tearDown();
+
+private:
+    SetTrie<string> *trie;
+    void testInsert();
+    void testHasSubset();
+    void testHasSuperset();
+    void testClear();
+
+};
+
+#endif /* SET_TRIE_TEST_H */
+
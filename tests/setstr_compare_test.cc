@@ -34,3 +34,13 @@ void setstr_compare_test::testLess() {
     CPPUNIT_ASSERT(result);
 }
 
+
+void setstr_compare_test::testHash() {
+    const set_str a = {"a", "b", "c"};
+    const set_str b = {"c", "b", "a"};
+    const set_str c = {"a", "b"};
+    setstr_hash _setstr_hash;
+    CPPUNIT_ASSERT(_setstr_hash(a) == _setstr_hash(b)
+            && setstr_hash::hash(a) == _setstr_hash(a)
+            && _setstr_hash(a) != _setstr_hash(c));
+}
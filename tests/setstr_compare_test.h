@@ -19,6 +19,7 @@ class setstr_compare_test : public CPPUNIT_NS::TestFixture {
     CPPUNIT_TEST_SUITE(setstr_compare_test);
 
     CPPUNIT_TEST(testLess);
+    CPPUNIT_TEST(testHash);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -30,6 +31,7 @@ public:
 
 private:
     void testLess();
+    void testHash();
 
 };
 
@@ -0,0 +1,104 @@
+/*! \file task_scheduler_test.cc
+ * 
+ * \brief Includes definitions of the task_scheduler_test class members defined
+ * in the task_scheduler_test.h file
+ *  
+ * \details
+ * This file contains definition of the undefined member functions of the class
+ * task_scheduler_test.
+ * 
+ */
+#include "task_scheduler_test.h"
+
+#include <vector>
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(task_scheduler_test);
+
+task_scheduler_test::task_scheduler_test() {
+}
+
+task_scheduler_test::~task_scheduler_test() {
+}
+
+void task_scheduler_test::setUp() {
+}
+
+void task_scheduler_test::tearDown() {
+}
+
+void task_scheduler_test::testTaskScheduler() {
+    TaskScheduler a, b(3);
+    CPPUNIT_ASSERT_MESSAGE("failed to construct the scheduler",
+            a.getThreads() >= 1 && b.getThreads() == 3);
+}
+
+void task_scheduler_test::testRun() {
+    TaskScheduler s(4);
+    std::vector<unsigned int> v(1000, 0);
+    s.run(v.size(), [&](unsigned int i) {
+        v[i] += i * i;
+    });
+    bool ok = true;
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        ok = ok && v[i] == i * i;
+    }
+    CPPUNIT_ASSERT_MESSAGE("failed to run every task once", ok);
+}
+
+void task_scheduler_test::testRun2() {
+    TaskScheduler s(8);
+    std::vector<unsigned long> v(37, 0);
+    s.run(v.size(), [&](unsigned int i) {
+        for (unsigned long k = 0; k < (i % 5) * 100000; ++k) {
+            v[i] += k % 3;
+        }
+    });
+    unsigned int count = 0;
+    s.run(0, [&](unsigned int) {
+        ++count;
+    });
+    bool ok = count == 0;
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        unsigned long n = (i % 5) * 100000;
+        ok = ok && v[i] == n / 3 * 3 + (n % 3 == 2 ? 1 : 0);
+    }
+    CPPUNIT_ASSERT_MESSAGE("failed to run uneven tasks", ok);
+}
+
+void task_scheduler_test::testRun3() {
+    TaskScheduler s(4);
+    std::vector<unsigned int> v(50, 0);
+    for (unsigned int r = 0; r < 200; ++r) {
+        s.run(r % v.size(), [&](unsigned int i) {
+            ++v[i];
+        });
+    }
+    bool ok = true;
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        ok = ok && v[i] == 4 * (v.size() - 1 - i);
+    }
+    CPPUNIT_ASSERT_MESSAGE("failed to reuse the threads across the runs", ok);
+}
+
+void task_scheduler_test::testGetShared() {
+    TaskScheduler &s = TaskScheduler::getShared();
+    std::vector<unsigned int> v(1000, 0);
+    std::vector<std::thread> callers;
+    for (unsigned int t = 0; t < 4; ++t) {
+        callers.push_back(std::thread([&, t] {
+            s.run(250, [&](unsigned int i) {
+                ++v[250 * t + i];
+            });
+        }));
+    }
+    for (std::thread &t : callers) {
+        t.join();
+    }
+    bool ok = &s == &TaskScheduler::getShared()
+            && s.getThreads() >= 1;
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        ok = ok && v[i] == 1;
+    }
+    CPPUNIT_ASSERT_MESSAGE("failed to share the scheduler", ok);
+}
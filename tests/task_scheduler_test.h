@@ -0,0 +1,44 @@
+/*! @file task_scheduler_test.h
+ * 
+ * @brief Includes declaration for the class task_scheduler_test and its members.
+ *  
+ * @details
+ * This file declares the definition of the class task_scheduler_test along with
+ * its subsequent data members and the member functions prototype. This class is
+ * designed to test the methods from the TaskScheduler class.
+ * 
+ */
+#ifndef TASK_SCHEDULER_TEST_H
+#define TASK_SCHEDULER_TEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../task_scheduler.h"
+
+class task_scheduler_test : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(task_scheduler_test);
+
+    CPPUNIT_TEST(testTaskScheduler);
+    CPPUNIT_TEST(testRun);
+    CPPUNIT_TEST(testRun2);
+    CPPUNIT_TEST(testRun3);
+    CPPUNIT_TEST(testGetShared);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    task_scheduler_test();
+    virtual ~task_scheduler_test();
+    void setUp();
+    void tearDown();
+
+private:
+    void testTaskScheduler();
+    void testRun();
+    void testRun2();
+    void testRun3();
+    void testGetShared();
+
+};
+
+#endif /* TASK_SCHEDULER_TEST_H */
+
@@ -36,6 +36,11 @@ struct Violation;
  */
 class Dependency;
 
+/*! 
+    Forward declaration of class \link Analyzer \endlink
+ */
+class Analyzer;
+
 //Used in NetBeans only.
 typedef std::string string;
 
@@ -71,6 +71,9 @@ public:
      *      -# and rhs is not prime attribute set
      * - Boyce-Codd(BC) normal form violation if
      *      -# lhs of Dependency is not super-key
+     * 
+     * The super-key test uses only the closure of the lhs, so the BCNF test 
+     * does not calculate the candidate keys.
      */
 
     bool operator()(const Dependency &dep) const {